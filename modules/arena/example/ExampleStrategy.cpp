@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/ButtonState.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/Strategy.hpp>
+
+namespace
+{
+  // clicks the first covered Button row by row, a starting point for a plugin
+  class ExampleStrategy : public fsweep::Strategy
+  {
+   public:
+    fsweep::ButtonPosition GetMove(const fsweep::GameModel& game_model) override
+    {
+      const auto game_configuration = game_model.GetGameConfiguration();
+      for (int y = 0; y < game_configuration.GetButtonsTall(); y++)
+      {
+        for (int x = 0; x < game_configuration.GetButtonsWide(); x++)
+        {
+          if (game_model.GetButton(x, y).GetButtonState() == fsweep::ButtonState::None)
+          {
+            return fsweep::ButtonPosition(x, y);
+          }
+        }
+      }
+      return fsweep::ButtonPosition();
+    }
+  };
+}  // namespace
+
+FSWEEP_STRATEGY_EXPORT fsweep::Strategy* FSWEEP_CREATE_STRATEGY() { return new ExampleStrategy(); }
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_STRATEGY_HPP
+#define FSWEEP_STRATEGY_HPP
+
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameModel.hpp>
+
+namespace fsweep
+{
+  // A player for fsweep_arena. The arena makes a new Strategy for every game and makes the first
+  // click itself, so every Strategy meets the same boards. A plugin is a shared library built
+  // against the same model headers that exports FSWEEP_CREATE_STRATEGY as a CreateStrategy.
+  class Strategy
+  {
+   public:
+    virtual ~Strategy() = default;
+
+    // called before the first move with a seed that the game's other players are given too
+    virtual void NewGame(std::uint64_t seed) { static_cast<void>(seed); }
+    // the covered Button to click next in a game that is Playing
+    virtual fsweep::ButtonPosition GetMove(const fsweep::GameModel& game_model) = 0;
+  };
+
+  using CreateStrategy = fsweep::Strategy* (*)();
+}  // namespace fsweep
+
+#define FSWEEP_CREATE_STRATEGY fsweep_create_strategy
+#define FSWEEP_CREATE_STRATEGY_NAME "fsweep_create_strategy"
+#ifdef _WIN32
+#define FSWEEP_STRATEGY_EXPORT extern "C" __declspec(dllexport)
+#else
+#define FSWEEP_STRATEGY_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+#endif
@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/ButtonState.hpp>
+#include <fsweep/CounterRng.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/GameState.hpp>
+#include <fsweep/LatencyHistogram.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Arena.hpp"
+#include "PluginLibrary.hpp"
+
+namespace
+{
+  bool getIsArenaMove(const fsweep::GameModel& game_model, const fsweep::ButtonPosition& position)
+  {
+    const auto game_configuration = game_model.GetGameConfiguration();
+    if (position.x < 0 || position.x >= game_configuration.GetButtonsWide()) return false;
+    if (position.y < 0 || position.y >= game_configuration.GetButtonsTall()) return false;
+    const auto button_state = game_model.GetButton(position.x, position.y).GetButtonState();
+    return button_state == fsweep::ButtonState::None ||
+           button_state == fsweep::ButtonState::Questioned;
+  }
+}  // namespace
+
+void fsweep::Arena::AddStrategy(std::string name, StrategyFactory factory)
+{
+  this->names.push_back(std::move(name));
+  this->factories.push_back(std::move(factory));
+}
+
+void fsweep::Arena::AddPlugin(std::string_view path)
+{
+  // every factory shares the library, so adding more plugins never moves one that is in use
+  auto plugin_library = std::make_shared<const fsweep::PluginLibrary>(path);
+  this->AddStrategy(std::filesystem::path(path).stem().string(),
+                    [plugin_library] { return plugin_library->CreateStrategy(); });
+}
+
+std::size_t fsweep::Arena::GetStrategyCount() const noexcept { return this->names.size(); }
+
+std::vector<fsweep::ArenaResult> fsweep::Arena::Run(
+    const fsweep::GameConfiguration& game_configuration, std::uint64_t game_count,
+    std::uint64_t seed, fsweep::ThreadPool& thread_pool) const
+{
+  const auto strategy_count = this->names.size();
+  std::vector<fsweep::ArenaResult> results(strategy_count);
+  for (std::size_t strategy_i = 0; strategy_i < strategy_count; strategy_i++)
+  {
+    results[strategy_i].name = this->names[strategy_i];
+  }
+  std::vector<std::mutex> result_mutexes(strategy_count);
+  // the strategies take turns so a slow one does not leave the last games to a single thread
+  thread_pool.ParallelFor(
+      static_cast<std::size_t>(game_count) * strategy_count,
+      [&](std::size_t task_i)
+      {
+        const auto game_i = task_i / strategy_count;
+        const auto strategy_i = task_i % strategy_count;
+        const auto board_seed = fsweep::CounterRng::Get(seed, game_i);
+        // the game runs on the calling thread since the arena already keeps every thread busy
+        fsweep::ThreadPool game_thread_pool(1);
+        fsweep::GameModel game_model;
+        game_model.SetThreadPool(game_thread_pool);
+        game_model.SetFrontierTracking(true);
+        game_model.NewGame(game_configuration);
+        game_model.SetSeed(board_seed);
+        game_model.ClickButton(game_configuration.GetButtonsWide() / 2,
+                               game_configuration.GetButtonsTall() / 2);
+        auto strategy = this->factories[strategy_i]();
+        strategy->NewGame(board_seed);
+        fsweep::LatencyHistogram move_histogram;
+        std::uint64_t move_count = 0;
+        std::uint64_t move_ns_sum = 0;
+        bool forfeit = false;
+        while (game_model.GetGameState() == fsweep::GameState::Playing)
+        {
+          const auto start_time = std::chrono::steady_clock::now();
+          const auto position = strategy->GetMove(game_model);
+          const auto move_ns = static_cast<std::uint64_t>(
+              std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  std::chrono::steady_clock::now() - start_time)
+                  .count());
+          move_histogram.Record(move_ns);
+          move_count++;
+          move_ns_sum += move_ns;
+          if (!getIsArenaMove(game_model, position))
+          {
+            forfeit = true;
+            break;
+          }
+          game_model.ClickButton(position.x, position.y);
+        }
+        std::lock_guard<std::mutex> result_lock(result_mutexes[strategy_i]);
+        auto& result = results[strategy_i];
+        result.game_count++;
+        if (game_model.GetGameState() == fsweep::GameState::Cool) result.win_count++;
+        if (forfeit) result.forfeit_count++;
+        result.move_count += move_count;
+        result.move_ns_sum += move_ns_sum;
+        result.move_histogram.Merge(move_histogram);
+      });
+  return results;
+}
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_ARENA_HPP
+#define FSWEEP_ARENA_HPP
+
+#include <cstdint>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/Strategy.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ArenaResult.hpp"
+
+namespace fsweep
+{
+  // Plays every strategy on the same boards. Board i is seeded from the arena seed and i, and the
+  // arena makes the first click in the middle, so the bombs do not depend on the strategy or on
+  // which thread plays the game. Each game gets a new Strategy from its factory.
+  class Arena
+  {
+   public:
+    using StrategyFactory = std::function<std::unique_ptr<fsweep::Strategy>()>;
+
+   private:
+    std::vector<std::string> names = std::vector<std::string>();
+    std::vector<StrategyFactory> factories = std::vector<StrategyFactory>();
+
+   public:
+    Arena() noexcept = default;
+
+    void AddStrategy(std::string name, StrategyFactory factory);
+    // plays the strategy of a PluginLibrary named after its file, which stays loaded as long as
+    // the factory that creates its strategies
+    void AddPlugin(std::string_view path);
+    std::size_t GetStrategyCount() const noexcept;
+    std::vector<fsweep::ArenaResult> Run(const fsweep::GameConfiguration& game_configuration,
+                                         std::uint64_t game_count, std::uint64_t seed,
+                                         fsweep::ThreadPool& thread_pool) const;
+  };
+}  // namespace fsweep
+
+#endif
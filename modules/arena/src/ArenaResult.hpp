@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_ARENA_RESULT_HPP
+#define FSWEEP_ARENA_RESULT_HPP
+
+#include <cstdint>
+#include <fsweep/LatencyHistogram.hpp>
+#include <string>
+
+namespace fsweep
+{
+  struct ArenaResult
+  {
+    std::string name = std::string();
+    std::uint64_t game_count = 0;
+    std::uint64_t win_count = 0;
+    // moves that were not a covered Button, each one loses its game
+    std::uint64_t forfeit_count = 0;
+    std::uint64_t move_count = 0;
+    std::uint64_t move_ns_sum = 0;
+    // nanoseconds spent in Strategy::GetMove
+    fsweep::LatencyHistogram move_histogram = fsweep::LatencyHistogram();
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fsweep/GameConfiguration.hpp>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ArenaResult.hpp"
+#include "ArenaWriter.hpp"
+
+namespace
+{
+  double getArenaWinRate(const fsweep::ArenaResult& result)
+  {
+    if (result.game_count == 0) return 0.0;
+    return static_cast<double>(result.win_count) / static_cast<double>(result.game_count);
+  }
+
+  double getArenaWinRateMargin(const fsweep::ArenaResult& result)
+  {
+    if (result.game_count == 0) return 0.0;
+    const auto win_rate = getArenaWinRate(result);
+    return 1.96 * std::sqrt(win_rate * (1.0 - win_rate) / static_cast<double>(result.game_count));
+  }
+
+  double getArenaMicroseconds(double nanoseconds) { return nanoseconds / 1000.0; }
+
+  double getArenaMeanMove(const fsweep::ArenaResult& result)
+  {
+    if (result.move_count == 0) return 0.0;
+    return getArenaMicroseconds(static_cast<double>(result.move_ns_sum) /
+                                static_cast<double>(result.move_count));
+  }
+
+  double getArenaPercentileMove(const fsweep::ArenaResult& result, double percentile)
+  {
+    return getArenaMicroseconds(
+        static_cast<double>(result.move_histogram.GetValueAtPercentile(percentile)));
+  }
+
+  std::string getArenaCsvField(std::string_view value)
+  {
+    if (value.find_first_of(",\"\n") == std::string_view::npos) return std::string(value);
+    std::string field = "\"";
+    for (const auto c : value)
+    {
+      if (c == '"') field += '"';
+      field += c;
+    }
+    field += '"';
+    return field;
+  }
+
+  std::string getArenaJsonString(std::string_view value)
+  {
+    std::string string = "\"";
+    for (const auto c : value)
+    {
+      if (c == '"' || c == '\\')
+      {
+        string += '\\';
+        string += c;
+      }
+      else if (static_cast<unsigned char>(c) < 0x20)
+      {
+        char escape[8];
+        std::snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned int>(c));
+        string += escape;
+      }
+      else
+      {
+        string += c;
+      }
+    }
+    string += '"';
+    return string;
+  }
+}  // namespace
+
+void fsweep::ArenaWriter::WriteCsv(std::ostream& stream,
+                                   const std::vector<fsweep::ArenaResult>& results)
+{
+  stream << "strategy,games,wins,win_rate,win_rate_margin,forfeits,moves,mean_move_us,"
+            "p50_move_us,p90_move_us,p99_move_us,max_move_us\n";
+  for (const auto& result : results)
+  {
+    stream << getArenaCsvField(result.name) << ',' << result.game_count << ','
+           << result.win_count << ',' << getArenaWinRate(result) << ','
+           << getArenaWinRateMargin(result) << ',' << result.forfeit_count << ','
+           << result.move_count << ',' << getArenaMeanMove(result) << ','
+           << getArenaPercentileMove(result, 50.0) << ',' << getArenaPercentileMove(result, 90.0)
+           << ',' << getArenaPercentileMove(result, 99.0) << ','
+           << getArenaMicroseconds(static_cast<double>(result.move_histogram.GetMax())) << '\n';
+  }
+}
+
+void fsweep::ArenaWriter::WriteJson(std::ostream& stream,
+                                    const fsweep::GameConfiguration& game_configuration,
+                                    std::uint64_t seed,
+                                    const std::vector<fsweep::ArenaResult>& results)
+{
+  stream << "{\"buttons_wide\":" << game_configuration.GetButtonsWide()
+         << ",\"buttons_tall\":" << game_configuration.GetButtonsTall()
+         << ",\"bomb_count\":" << game_configuration.GetBombCount() << ",\"seed\":" << seed
+         << ",\"strategies\":[";
+  for (std::size_t result_i = 0; result_i < results.size(); result_i++)
+  {
+    const auto& result = results[result_i];
+    if (result_i > 0) stream << ',';
+    stream << "\n{\"strategy\":" << getArenaJsonString(result.name)
+           << ",\"games\":" << result.game_count << ",\"wins\":" << result.win_count
+           << ",\"win_rate\":" << getArenaWinRate(result)
+           << ",\"win_rate_margin\":" << getArenaWinRateMargin(result)
+           << ",\"forfeits\":" << result.forfeit_count << ",\"moves\":" << result.move_count
+           << ",\"mean_move_us\":" << getArenaMeanMove(result)
+           << ",\"p50_move_us\":" << getArenaPercentileMove(result, 50.0)
+           << ",\"p90_move_us\":" << getArenaPercentileMove(result, 90.0)
+           << ",\"p99_move_us\":" << getArenaPercentileMove(result, 99.0) << ",\"max_move_us\":"
+           << getArenaMicroseconds(static_cast<double>(result.move_histogram.GetMax())) << '}';
+  }
+  stream << "\n]}\n";
+}
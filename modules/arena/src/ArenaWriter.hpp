@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_ARENA_WRITER_HPP
+#define FSWEEP_ARENA_WRITER_HPP
+
+#include <cstdint>
+#include <fsweep/GameConfiguration.hpp>
+#include <ostream>
+#include <vector>
+
+#include "ArenaResult.hpp"
+
+namespace fsweep
+{
+  // writes one row per strategy, with move times in microseconds and the win rate margin being
+  // half of a 95% confidence interval
+  class ArenaWriter
+  {
+   public:
+    static void WriteCsv(std::ostream& stream, const std::vector<fsweep::ArenaResult>& results);
+    static void WriteJson(std::ostream& stream, const fsweep::GameConfiguration& game_configuration,
+                          std::uint64_t seed, const std::vector<fsweep::ArenaResult>& results);
+  };
+}  // namespace fsweep
+
+#endif
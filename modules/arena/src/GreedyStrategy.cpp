@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <chrono>
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/HintEngine.hpp>
+
+#include "GreedyStrategy.hpp"
+
+fsweep::GreedyStrategy::GreedyStrategy(std::chrono::microseconds time_budget)
+    : thread_pool(1), risk_sampler(this->thread_pool)
+{
+  this->risk_sampler.SetTimeBudget(time_budget);
+}
+
+void fsweep::GreedyStrategy::NewGame(std::uint64_t seed) { this->random_strategy.NewGame(seed); }
+
+fsweep::ButtonPosition fsweep::GreedyStrategy::GetMove(const fsweep::GameModel& game_model)
+{
+  const auto hint = fsweep::HintEngine::Analyze(game_model, &this->risk_sampler);
+  if (hint) return fsweep::ButtonPosition(hint->x, hint->y);
+  return this->random_strategy.GetMove(game_model);
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_GREEDY_STRATEGY_HPP
+#define FSWEEP_GREEDY_STRATEGY_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/RiskSampler.hpp>
+#include <fsweep/Strategy.hpp>
+#include <fsweep/ThreadPool.hpp>
+
+#include "RandomStrategy.hpp"
+
+namespace fsweep
+{
+  // clicks the Button least likely to hide a bomb, with the frontier risks sampled by a
+  // RiskSampler on the calling thread since the arena already keeps every core busy. The sampler
+  // stops at a time budget, so how many samples a move gets depends on the machine and its load,
+  // and unlike the other strategies its games can not be reproduced from the arena seed.
+  class GreedyStrategy : public fsweep::Strategy
+  {
+   private:
+    fsweep::ThreadPool thread_pool;
+    fsweep::RiskSampler risk_sampler;
+    fsweep::RandomStrategy random_strategy = fsweep::RandomStrategy();
+
+   public:
+    explicit GreedyStrategy(std::chrono::microseconds time_budget);
+
+    void NewGame(std::uint64_t seed) override;
+    fsweep::ButtonPosition GetMove(const fsweep::GameModel& game_model) override;
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <fsweep/Strategy.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "PluginLibrary.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#ifdef _WIN32
+
+fsweep::PluginLibrary::PluginLibrary(std::string_view path)
+{
+  this->handle = LoadLibraryA(std::string(path).c_str());
+  if (this->handle == nullptr) throw std::runtime_error("could not load plugin");
+  this->create_strategy = reinterpret_cast<fsweep::CreateStrategy>(
+      GetProcAddress(static_cast<HMODULE>(this->handle), FSWEEP_CREATE_STRATEGY_NAME));
+  if (this->create_strategy == nullptr)
+  {
+    FreeLibrary(static_cast<HMODULE>(this->handle));
+    throw std::runtime_error("plugin does not export a strategy");
+  }
+}
+
+fsweep::PluginLibrary::~PluginLibrary() { FreeLibrary(static_cast<HMODULE>(this->handle)); }
+
+#else
+
+fsweep::PluginLibrary::PluginLibrary(std::string_view path)
+{
+  this->handle = dlopen(std::string(path).c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (this->handle == nullptr) throw std::runtime_error("could not load plugin");
+  this->create_strategy =
+      reinterpret_cast<fsweep::CreateStrategy>(dlsym(this->handle, FSWEEP_CREATE_STRATEGY_NAME));
+  if (this->create_strategy == nullptr)
+  {
+    dlclose(this->handle);
+    throw std::runtime_error("plugin does not export a strategy");
+  }
+}
+
+fsweep::PluginLibrary::~PluginLibrary() { dlclose(this->handle); }
+
+#endif
+
+std::unique_ptr<fsweep::Strategy> fsweep::PluginLibrary::CreateStrategy() const
+{
+  auto strategy = std::unique_ptr<fsweep::Strategy>(this->create_strategy());
+  if (!strategy) throw std::runtime_error("plugin did not create a strategy");
+  return strategy;
+}
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_PLUGIN_LIBRARY_HPP
+#define FSWEEP_PLUGIN_LIBRARY_HPP
+
+#include <fsweep/Strategy.hpp>
+#include <memory>
+#include <string_view>
+
+namespace fsweep
+{
+  // a shared library exporting FSWEEP_CREATE_STRATEGY, it has to outlive its strategies
+  class PluginLibrary
+  {
+   private:
+    void* handle = nullptr;
+    fsweep::CreateStrategy create_strategy = nullptr;
+
+   public:
+    explicit PluginLibrary(std::string_view path);
+    PluginLibrary(const fsweep::PluginLibrary&) = delete;
+    fsweep::PluginLibrary& operator=(const fsweep::PluginLibrary&) = delete;
+    ~PluginLibrary();
+
+    std::unique_ptr<fsweep::Strategy> CreateStrategy() const;
+  };
+}  // namespace fsweep
+
+#endif
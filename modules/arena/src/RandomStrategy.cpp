@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/ButtonState.hpp>
+#include <fsweep/CounterRng.hpp>
+#include <fsweep/GameModel.hpp>
+
+#include "RandomStrategy.hpp"
+
+namespace
+{
+  bool getIsRandomChoice(const fsweep::Button& button)
+  {
+    return button.GetButtonState() == fsweep::ButtonState::None ||
+           button.GetButtonState() == fsweep::ButtonState::Questioned;
+  }
+}  // namespace
+
+void fsweep::RandomStrategy::NewGame(std::uint64_t seed)
+{
+  this->seed = seed;
+  this->counter = 0;
+}
+
+fsweep::ButtonPosition fsweep::RandomStrategy::GetMove(const fsweep::GameModel& game_model)
+{
+  const auto& buttons = game_model.GetButtons();
+  std::size_t choice_count = 0;
+  for (const auto& button : buttons)
+  {
+    if (getIsRandomChoice(button)) choice_count++;
+  }
+  const auto buttons_wide = game_model.GetGameConfiguration().GetButtonsWide();
+  if (choice_count == 0) return fsweep::ButtonPosition(0, 0);
+  auto choice_i = fsweep::CounterRng::Get(this->seed, this->counter++) % choice_count;
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i++)
+  {
+    if (!getIsRandomChoice(buttons[button_i])) continue;
+    if (choice_i-- == 0)
+    {
+      return fsweep::ButtonPosition(static_cast<int>(button_i % buttons_wide),
+                                    static_cast<int>(button_i / buttons_wide));
+    }
+  }
+  return fsweep::ButtonPosition(0, 0);
+}
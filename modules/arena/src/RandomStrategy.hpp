@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_RANDOM_STRATEGY_HPP
+#define FSWEEP_RANDOM_STRATEGY_HPP
+
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/Strategy.hpp>
+
+namespace fsweep
+{
+  // clicks any covered Button that is not flagged, each as likely as the others
+  class RandomStrategy : public fsweep::Strategy
+  {
+   private:
+    std::uint64_t seed = 0;
+    std::uint64_t counter = 0;
+
+   public:
+    RandomStrategy() noexcept = default;
+
+    void NewGame(std::uint64_t seed) override;
+    fsweep::ButtonPosition GetMove(const fsweep::GameModel& game_model) override;
+  };
+}  // namespace fsweep
+
+#endif
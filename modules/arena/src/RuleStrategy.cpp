@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/HintEngine.hpp>
+
+#include "RuleStrategy.hpp"
+
+void fsweep::RuleStrategy::NewGame(std::uint64_t seed) { this->random_strategy.NewGame(seed); }
+
+fsweep::ButtonPosition fsweep::RuleStrategy::GetMove(const fsweep::GameModel& game_model)
+{
+  const auto hint = fsweep::HintEngine::Analyze(game_model);
+  if (hint && hint->GetIsSafe()) return fsweep::ButtonPosition(hint->x, hint->y);
+  return this->random_strategy.GetMove(game_model);
+}
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_RULE_STRATEGY_HPP
+#define FSWEEP_RULE_STRATEGY_HPP
+
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/Strategy.hpp>
+
+#include "RandomStrategy.hpp"
+
+namespace fsweep
+{
+  // clicks a Button that the HintEngine proves safe and guesses at random when there is none
+  class RuleStrategy : public fsweep::Strategy
+  {
+   private:
+    fsweep::RandomStrategy random_strategy = fsweep::RandomStrategy();
+
+   public:
+    RuleStrategy() noexcept = default;
+
+    void NewGame(std::uint64_t seed) override;
+    fsweep::ButtonPosition GetMove(const fsweep::GameModel& game_model) override;
+  };
+}  // namespace fsweep
+
+#endif
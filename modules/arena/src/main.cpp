@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameDifficulty.hpp>
+#include <fsweep/RiskSampler.hpp>
+#include <fsweep/Strategy.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Arena.hpp"
+#include "ArenaWriter.hpp"
+#include "GreedyStrategy.hpp"
+#include "RandomStrategy.hpp"
+#include "RuleStrategy.hpp"
+
+namespace
+{
+  const char* const ARENA_USAGE =
+      "usage: fsweep_arena [options]\n"
+      "  --games <count>          games per strategy (default 1000)\n"
+      "  --seed <seed>            seed of the boards (default 1)\n"
+      "  --difficulty <name>      beginner, intermediate or expert (default expert)\n"
+      "  --width <buttons>        custom board width\n"
+      "  --height <buttons>       custom board height\n"
+      "  --bombs <count>          custom bomb count\n"
+      "  --strategies <names>     comma separated list of random, rules and greedy\n"
+      "                           (default random,rules,greedy)\n"
+      "  --plugin <path>          also play the strategy of a shared library, can be repeated\n"
+      "  --threads <count>        games played at once (default every hardware thread)\n"
+      "  --sample-us <us>         time the greedy strategy samples each move (default 4000),\n"
+      "                           so unlike the others its results vary from run to run\n"
+      "  --format <name>          csv or json (default csv)\n"
+      "  --output <path>          write the results to a file instead of the standard output\n";
+
+  std::uint64_t getArenaNumber(std::string_view value)
+  {
+    if (value.empty() || value.find_first_not_of("0123456789") != std::string_view::npos)
+    {
+      throw std::runtime_error("expected a number");
+    }
+    return std::stoull(std::string(value));
+  }
+
+  int getArenaInt(std::string_view value)
+  {
+    const auto number = getArenaNumber(value);
+    if (number > static_cast<std::uint64_t>(fsweep::GameConfiguration::MAX_BUTTONS_WIDE))
+    {
+      throw std::runtime_error("number is too large");
+    }
+    return static_cast<int>(number);
+  }
+
+  fsweep::GameDifficulty getArenaDifficulty(std::string_view value)
+  {
+    if (value == "beginner") return fsweep::GameDifficulty::Beginner;
+    if (value == "intermediate") return fsweep::GameDifficulty::Intermediate;
+    if (value == "expert") return fsweep::GameDifficulty::Expert;
+    throw std::runtime_error("unknown difficulty");
+  }
+
+  void addArenaStrategy(fsweep::Arena& arena, std::string_view name,
+                        std::chrono::microseconds sample_time)
+  {
+    if (name == "random")
+    {
+      arena.AddStrategy("random", [] { return std::make_unique<fsweep::RandomStrategy>(); });
+    }
+    else if (name == "rules")
+    {
+      arena.AddStrategy("rules", [] { return std::make_unique<fsweep::RuleStrategy>(); });
+    }
+    else if (name == "greedy")
+    {
+      arena.AddStrategy("greedy", [sample_time]
+                        { return std::make_unique<fsweep::GreedyStrategy>(sample_time); });
+    }
+    else
+    {
+      throw std::runtime_error("unknown strategy");
+    }
+  }
+
+  int runArena(const std::vector<std::string_view>& args)
+  {
+    std::uint64_t game_count = 1000;
+    std::uint64_t seed = 1;
+    auto difficulty = fsweep::GameDifficulty::Expert;
+    int buttons_wide = 0;
+    int buttons_tall = 0;
+    int bomb_count = -1;
+    std::string_view strategy_names = "random,rules,greedy";
+    std::vector<std::string_view> plugin_paths;
+    unsigned int thread_count = std::max(1u, std::thread::hardware_concurrency());
+    auto sample_time = fsweep::RiskSampler::DEFAULT_TIME_BUDGET;
+    std::string_view format = "csv";
+    std::string_view output_path;
+    for (std::size_t arg_i = 0; arg_i < args.size(); arg_i++)
+    {
+      const auto arg = args[arg_i];
+      if (arg == "--help" || arg == "-h")
+      {
+        std::cout << ARENA_USAGE;
+        return 0;
+      }
+      if (arg_i + 1 == args.size()) throw std::runtime_error("missing option value");
+      const auto value = args[++arg_i];
+      if (arg == "--games")
+        game_count = getArenaNumber(value);
+      else if (arg == "--seed")
+        seed = getArenaNumber(value);
+      else if (arg == "--difficulty")
+        difficulty = getArenaDifficulty(value);
+      else if (arg == "--width")
+        buttons_wide = getArenaInt(value);
+      else if (arg == "--height")
+        buttons_tall = getArenaInt(value);
+      else if (arg == "--bombs")
+        bomb_count = getArenaInt(value);
+      else if (arg == "--strategies")
+        strategy_names = value;
+      else if (arg == "--plugin")
+        plugin_paths.push_back(value);
+      else if (arg == "--threads")
+        thread_count = std::max(1, getArenaInt(value));
+      else if (arg == "--sample-us")
+        sample_time = std::chrono::microseconds(getArenaNumber(value));
+      else if (arg == "--format")
+        format = value;
+      else if (arg == "--output")
+        output_path = value;
+      else
+        throw std::runtime_error("unknown option");
+    }
+    if (format != "csv" && format != "json") throw std::runtime_error("unknown format");
+
+    auto game_configuration = fsweep::GameConfiguration(difficulty);
+    if (buttons_wide > 0 || buttons_tall > 0 || bomb_count >= 0)
+    {
+      game_configuration = fsweep::GameConfiguration(
+          buttons_wide > 0 ? buttons_wide : game_configuration.GetButtonsWide(),
+          buttons_tall > 0 ? buttons_tall : game_configuration.GetButtonsTall(),
+          bomb_count >= 0 ? bomb_count : game_configuration.GetBombCount());
+    }
+
+    fsweep::Arena arena;
+    std::size_t name_begin = 0;
+    while (name_begin < strategy_names.size())
+    {
+      auto name_end = strategy_names.find(',', name_begin);
+      if (name_end == std::string_view::npos) name_end = strategy_names.size();
+      if (name_end > name_begin)
+      {
+        addArenaStrategy(arena, strategy_names.substr(name_begin, name_end - name_begin),
+                         sample_time);
+      }
+      name_begin = name_end + 1;
+    }
+    for (const auto plugin_path : plugin_paths)
+    {
+      arena.AddPlugin(plugin_path);
+    }
+    if (arena.GetStrategyCount() == 0) throw std::runtime_error("no strategies to play");
+
+    fsweep::ThreadPool thread_pool(thread_count);
+    const auto results = arena.Run(game_configuration, game_count, seed, thread_pool);
+
+    std::ofstream output_stream;
+    if (!output_path.empty())
+    {
+      output_stream.open(std::string(output_path));
+      if (!output_stream) throw std::runtime_error("could not open file");
+    }
+    auto& stream = output_path.empty() ? std::cout : output_stream;
+    if (format == "json")
+      fsweep::ArenaWriter::WriteJson(stream, game_configuration, seed, results);
+    else
+      fsweep::ArenaWriter::WriteCsv(stream, results);
+    return 0;
+  }
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  try
+  {
+    return runArena(std::vector<std::string_view>(argv + 1, argv + argc));
+  }
+  catch (const std::exception& exception)
+  {
+    std::cerr << "fsweep_arena: " << exception.what() << '\n' << ARENA_USAGE;
+    return 1;
+  }
+}
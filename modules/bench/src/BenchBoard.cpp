@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "BenchBoard.hpp"
+
+#include <array>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameDifficulty.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+  struct BenchDensity
+  {
+    const char* name;
+    int percent;
+  };
+}  // namespace
+
+const std::array<int, 3> CUSTOM_DIMENSIONS = {100, 500, 2000};
+const std::array<BenchDensity, 3> CUSTOM_DENSITIES = {
+    BenchDensity{"low", 10},
+    BenchDensity{"medium", 20},
+    BenchDensity{"high", 30},
+};
+
+std::vector<fsweep::BenchBoard> fsweep::getBenchBoards()
+{
+  std::vector<fsweep::BenchBoard> boards = {
+      {"beginner", fsweep::GameConfiguration(fsweep::GameDifficulty::Beginner)},
+      {"intermediate", fsweep::GameConfiguration(fsweep::GameDifficulty::Intermediate)},
+      {"expert", fsweep::GameConfiguration(fsweep::GameDifficulty::Expert)},
+  };
+  for (const auto dimension : CUSTOM_DIMENSIONS)
+  {
+    for (const auto& density : CUSTOM_DENSITIES)
+    {
+      const int bomb_count = (dimension * dimension / 100) * density.percent;
+      boards.push_back({std::to_string(dimension) + "x" + std::to_string(dimension) + " " +
+                            density.name + " density",
+                        fsweep::GameConfiguration(dimension, dimension, bomb_count)});
+    }
+  }
+  return boards;
+}
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <fsweep/DesktopModel.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/Sprite.hpp>
+
+#include "BenchBoard.hpp"
+#include "BenchGameModel.hpp"
+
+const unsigned int DESKTOP_BENCH_SEED = 5489u;
+
+namespace
+{
+  int sumButtonSprites(const fsweep::DesktopModel& desktop_model,
+                       const fsweep::GameConfiguration& game_configuration)
+  {
+    int sprite_sum = 0;
+    for (int x = 0; x < game_configuration.GetButtonsWide(); x++)
+    {
+      for (int y = 0; y < game_configuration.GetButtonsTall(); y++)
+      {
+        sprite_sum += static_cast<int>(desktop_model.GetButtonSprite(x, y));
+      }
+    }
+    return sprite_sum;
+  }
+}  // namespace
+
+TEST_CASE("Benchmark DesktopModel::GetButtonSprite", "[benchmark][GetButtonSprite]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    const auto& game_configuration = board.game_configuration;
+    fsweep::BenchGameModel game_model(game_configuration, DESKTOP_BENCH_SEED);
+    fsweep::DesktopModel desktop_model(game_model);
+    game_model.ClickButton(game_configuration.GetButtonsWide() / 2,
+                           game_configuration.GetButtonsTall() / 2);
+    desktop_model.MouseMove(desktop_model.GetButtonPoint(0, 0).x,
+                            desktop_model.GetButtonPoint(0, 0).y);
+    desktop_model.LeftPress();
+    BENCHMARK("GetButtonSprite all buttons " + board.name)
+    {
+      return sumButtonSprites(desktop_model, game_configuration);
+    };
+  }
+}
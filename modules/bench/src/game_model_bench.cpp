@@ -0,0 +1,325 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameFile.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/HintEngine.hpp>
+#include <fsweep/OptimalSolver.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "BenchBoard.hpp"
+#include "BenchGameModel.hpp"
+
+const unsigned int BENCH_SEED = 5489u;
+
+namespace
+{
+  fsweep::ButtonPosition getCenterPosition(const fsweep::GameConfiguration& game_configuration)
+  {
+    return fsweep::ButtonPosition(game_configuration.GetButtonsWide() / 2,
+                                  game_configuration.GetButtonsTall() / 2);
+  }
+
+  std::optional<fsweep::ButtonPosition> prepareAreaClick(fsweep::BenchGameModel& game_model)
+  {
+    const auto game_configuration = game_model.GetGameConfiguration();
+    const auto buttons_wide = game_configuration.GetButtonsWide();
+    const auto buttons_tall = game_configuration.GetButtonsTall();
+    for (int y = 0; y < buttons_tall; y++)
+    {
+      for (int x = 0; x < buttons_wide; x++)
+      {
+        const auto& button = game_model.GetButton(x, y);
+        if (button.GetButtonState() != fsweep::ButtonState::Down || button.GetHasBomb() ||
+            button.GetSurroundingBombs() == 0)
+        {
+          continue;
+        }
+        std::vector<fsweep::ButtonPosition> bomb_positions;
+        bool has_pressable = false;
+        for (int near_y = y - 1; near_y <= y + 1; near_y++)
+        {
+          for (int near_x = x - 1; near_x <= x + 1; near_x++)
+          {
+            if (near_x < 0 || near_y < 0 || near_x >= buttons_wide || near_y >= buttons_tall)
+              continue;
+            const auto& near_button = game_model.GetButton(near_x, near_y);
+            if (near_button.GetHasBomb())
+            {
+              bomb_positions.emplace_back(near_x, near_y);
+            }
+            else if (near_button.GetIsPressable())
+            {
+              has_pressable = true;
+            }
+          }
+        }
+        if (!has_pressable) continue;
+        for (const auto& bomb_position : bomb_positions)
+        {
+          game_model.AltClickButton(bomb_position.x, bomb_position.y);
+        }
+        return fsweep::ButtonPosition(x, y);
+      }
+    }
+    return std::nullopt;
+  }
+}  // namespace
+
+TEST_CASE("Benchmark placeBombs", "[benchmark][placeBombs]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    fsweep::BenchGameModel game_model(board.game_configuration, BENCH_SEED);
+    const auto center_position = getCenterPosition(board.game_configuration);
+    BENCHMARK("placeBombs " + board.name)
+    {
+      game_model.PlaceBombs(center_position.x, center_position.y);
+      return game_model.GetGameConfiguration().GetButtonCount();
+    };
+  }
+}
+
+TEST_CASE("Benchmark calculateSurroundingBombs", "[benchmark][calculateSurroundingBombs]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    fsweep::BenchGameModel game_model(board.game_configuration, BENCH_SEED);
+    const auto center_position = getCenterPosition(board.game_configuration);
+    game_model.PlaceBombs(center_position.x, center_position.y);
+    BENCHMARK("calculateSurroundingBombs " + board.name)
+    {
+      game_model.CalculateSurroundingBombs();
+      return game_model.GetGameConfiguration().GetButtonCount();
+    };
+  }
+}
+
+TEST_CASE("Benchmark floodFillClick", "[benchmark][floodFillClick]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    const auto center_position = getCenterPosition(board.game_configuration);
+    BENCHMARK_ADVANCED("floodFillClick " + board.name)(Catch::Benchmark::Chronometer meter)
+    {
+      std::vector<fsweep::BenchGameModel> game_models(meter.runs());
+      for (auto& game_model : game_models)
+      {
+        game_model.NewGame(board.game_configuration);
+        game_model.Seed(BENCH_SEED);
+        game_model.PlaceBombs(center_position.x, center_position.y);
+      }
+      meter.measure(
+          [&](int run_i)
+          {
+            auto& game_model = game_models[run_i];
+            game_model.FloodFillClick(center_position.x, center_position.y);
+            return game_model.GetButtonsLeft();
+          });
+    };
+  }
+}
+
+TEST_CASE("Benchmark AreaClickButton", "[benchmark][AreaClickButton]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    const auto center_position = getCenterPosition(board.game_configuration);
+    BENCHMARK_ADVANCED("AreaClickButton " + board.name)(Catch::Benchmark::Chronometer meter)
+    {
+      std::vector<fsweep::BenchGameModel> game_models(meter.runs());
+      std::vector<std::optional<fsweep::ButtonPosition>> area_positions;
+      area_positions.reserve(meter.runs());
+      for (auto& game_model : game_models)
+      {
+        game_model.NewGame(board.game_configuration);
+        game_model.Seed(BENCH_SEED);
+        game_model.ClickButton(center_position.x, center_position.y);
+        area_positions.push_back(prepareAreaClick(game_model));
+      }
+      meter.measure(
+          [&](int run_i)
+          {
+            auto& game_model = game_models[run_i];
+            const auto& area_position = area_positions[run_i];
+            if (area_position.has_value())
+            {
+              game_model.AreaClickButton(area_position->x, area_position->y);
+            }
+            return game_model.GetButtonsLeft();
+          });
+    };
+  }
+}
+
+TEST_CASE("Benchmark the first ClickButton", "[benchmark][ClickButton]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    const auto center_position = getCenterPosition(board.game_configuration);
+    for (const bool lazy_counting : {false, true})
+    {
+      const std::string counting_name = lazy_counting ? "lazy " : "eager ";
+      BENCHMARK_ADVANCED("ClickButton " + counting_name + board.name)
+      (Catch::Benchmark::Chronometer meter)
+      {
+        std::vector<fsweep::BenchGameModel> game_models(meter.runs());
+        for (auto& game_model : game_models)
+        {
+          game_model.NewGame(board.game_configuration);
+          game_model.Seed(BENCH_SEED);
+          game_model.SetLazyCounting(lazy_counting);
+        }
+        meter.measure(
+            [&](int run_i)
+            {
+              auto& game_model = game_models[run_i];
+              game_model.ClickButton(center_position.x, center_position.y);
+              return game_model.GetButtonsLeft();
+            });
+      };
+    }
+  }
+}
+
+TEST_CASE("Benchmark NewGame", "[benchmark][NewGame]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    const auto center_position = getCenterPosition(board.game_configuration);
+    BENCHMARK_ADVANCED("NewGame " + board.name)(Catch::Benchmark::Chronometer meter)
+    {
+      std::vector<fsweep::BenchGameModel> game_models(meter.runs());
+      for (auto& game_model : game_models)
+      {
+        game_model.NewGame(board.game_configuration);
+        game_model.Seed(BENCH_SEED);
+        game_model.ClickButton(center_position.x, center_position.y);
+      }
+      meter.measure(
+          [&](int run_i)
+          {
+            auto& game_model = game_models[run_i];
+            game_model.NewGame();
+            return game_model.GetButtonsLeft();
+          });
+    };
+  }
+}
+
+TEST_CASE("Benchmark the GameModel button string constructor", "[benchmark][GameModel]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    fsweep::BenchGameModel source_model(board.game_configuration, BENCH_SEED);
+    const auto center_position = getCenterPosition(board.game_configuration);
+    source_model.ClickButton(center_position.x, center_position.y);
+    const auto button_string = source_model.ToButtonString();
+    BENCHMARK("GameModel(string) " + board.name)
+    {
+      const fsweep::GameModel game_model(board.game_configuration, false,
+                                         fsweep::GameState::Playing, 0, button_string);
+      return game_model.GetButtonsLeft();
+    };
+  }
+}
+
+TEST_CASE("Benchmark the GameFile writer and reader", "[benchmark][GameFile]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    fsweep::BenchGameModel source_model(board.game_configuration, BENCH_SEED);
+    const auto center_position = getCenterPosition(board.game_configuration);
+    source_model.ClickButton(center_position.x, center_position.y);
+    BENCHMARK("GameFile::Write " + board.name)
+    {
+      std::ostringstream stream;
+      fsweep::GameFile::Write(source_model, stream);
+      return stream.tellp();
+    };
+    std::ostringstream stream;
+    fsweep::GameFile::Write(source_model, stream);
+    const auto file_string = stream.str();
+    const std::vector<std::uint8_t> file_data(file_string.begin(), file_string.end());
+    BENCHMARK("GameFile::Read " + board.name)
+    {
+      return fsweep::GameFile::Read(file_data)->GetButtonsLeft();
+    };
+  }
+}
+
+TEST_CASE("Benchmark the button string writer", "[benchmark][ToButtonString]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    fsweep::BenchGameModel game_model(board.game_configuration, BENCH_SEED);
+    const auto center_position = getCenterPosition(board.game_configuration);
+    game_model.ClickButton(center_position.x, center_position.y);
+    BENCHMARK("ToButtonString " + board.name) { return game_model.ToButtonString().size(); };
+  }
+}
+
+TEST_CASE("Benchmark GameModel Clone", "[benchmark][Clone]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    fsweep::BenchGameModel game_model(board.game_configuration, BENCH_SEED);
+    const auto center_position = getCenterPosition(board.game_configuration);
+    game_model.ClickButton(center_position.x, center_position.y);
+    BENCHMARK("Clone " + board.name) { return game_model.Clone().GetButtonsLeft(); };
+  }
+}
+
+TEST_CASE("Benchmark the HintEngine analysis", "[benchmark][HintEngine]")
+{
+  for (const auto& board : fsweep::getBenchBoards())
+  {
+    fsweep::BenchGameModel game_model(board.game_configuration, BENCH_SEED);
+    game_model.SetFrontierTracking(true);
+    const auto center_position = getCenterPosition(board.game_configuration);
+    game_model.ClickButton(center_position.x, center_position.y);
+    BENCHMARK("HintEngine Analyze " + board.name)
+    {
+      return fsweep::HintEngine::Analyze(game_model).has_value();
+    };
+  }
+}
+
+TEST_CASE("Benchmark the OptimalSolver", "[benchmark][OptimalSolver]")
+{
+  const fsweep::GameConfiguration game_configuration(8, 2, 3);
+  BENCHMARK("OptimalSolver Solve 8x2 with 3 bombs")
+  {
+    fsweep::OptimalSolver optimal_solver(game_configuration);
+    optimal_solver.Solve(fsweep::ThreadPool::GetInstance());
+    return optimal_solver.GetWinProbability();
+  };
+}
@@ -22,12 +22,30 @@
 
 #include "DesktopApp.hpp"
 
+#include <cstdlib>
 #include <fsweep/GameModel.hpp>
+#include <fsweep/Trace.hpp>
 
 #include "DesktopView.hpp"
+#include "LatencyMonitor.hpp"
 
 bool fsweep::DesktopApp::OnInit()
 {
   if (!wxApp::OnInit()) return false;
   return this->view.Run();
 }
+
+int fsweep::DesktopApp::OnExit()
+{
+#ifdef FSWEEP_ENABLE_TRACING
+  const char* trace_path = std::getenv("FSWEEP_TRACE_FILE");
+  fsweep::TraceRecorder::GetInstance().WriteChromeTrace(
+      trace_path != nullptr ? trace_path : "fosssweeper_trace.json");
+#endif
+#ifdef FSWEEP_MEASURE_LATENCY
+  const char* latency_path = std::getenv("FSWEEP_LATENCY_FILE");
+  fsweep::LatencyMonitor::GetInstance().Write(
+      latency_path != nullptr ? latency_path : "fosssweeper_latency.txt");
+#endif
+  return wxApp::OnExit();
+}
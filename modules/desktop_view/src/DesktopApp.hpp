@@ -42,6 +42,7 @@ namespace fsweep
    public:
     DesktopApp() noexcept = default;
     bool OnInit() override;
+    int OnExit() override;
   };
 }  // namespace fsweep
 
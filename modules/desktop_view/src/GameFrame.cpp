@@ -70,6 +70,7 @@ fsweep::GameFrame::GameFrame(fsweep::DesktopView& view)
 
   // create game menu items
   auto* const new_item = new wxMenuItem(game_menu, wxID_NEW, "&New\tF2");
+  auto* const hint_item = new wxMenuItem(game_menu, wxID_ANY, "&Hint\tCtrl+H");
   beginner_item = new wxMenuItem(game_menu, wxID_ANY, "&Beginner");
   beginner_item->SetCheckable(true);
   intermediate_item = new wxMenuItem(game_menu, wxID_ANY, "&Intermediate");
@@ -79,21 +80,26 @@ fsweep::GameFrame::GameFrame(fsweep::DesktopView& view)
   auto* const custom_item = new wxMenuItem(game_menu, wxID_ANY, "&Custom...");
   question_marks_item = new wxMenuItem(game_menu, wxID_ANY, "&Question Marks");
   question_marks_item->SetCheckable(true);
+  risk_overlay_item = new wxMenuItem(game_menu, wxID_ANY, "&Risk Overlay");
+  risk_overlay_item->SetCheckable(true);
   auto* const pixel_scale_item = new wxMenuItem(game_menu, wxID_ANY, "&Pixel Scale...");
   auto* const exit_item = new wxMenuItem(game_menu, wxID_EXIT, "&Exit\tAlt+F4");
 
   // bind game menu items
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnNew, this, new_item->GetId());
+  Bind(wxEVT_MENU, &fsweep::GameFrame::OnHint, this, hint_item->GetId());
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnBeginner, this, beginner_item->GetId());
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnIntermediate, this, intermediate_item->GetId());
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnExpert, this, expert_item->GetId());
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnCustom, this, custom_item->GetId());
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnQuestionMarks, this, question_marks_item->GetId());
+  Bind(wxEVT_MENU, &fsweep::GameFrame::OnRiskOverlay, this, risk_overlay_item->GetId());
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnPixelScale, this, pixel_scale_item->GetId());
   Bind(wxEVT_MENU, &fsweep::GameFrame::OnExit, this, exit_item->GetId());
 
   // append menu items to game menu
   game_menu->Append(new_item);
+  game_menu->Append(hint_item);
   game_menu->AppendSeparator();
   game_menu->Append(beginner_item);
   game_menu->Append(intermediate_item);
@@ -101,6 +107,7 @@ fsweep::GameFrame::GameFrame(fsweep::DesktopView& view)
   game_menu->Append(custom_item);
   game_menu->AppendSeparator();
   game_menu->Append(question_marks_item);
+  game_menu->Append(risk_overlay_item);
   game_menu->Append(pixel_scale_item);
   game_menu->AppendSeparator();
   game_menu->Append(exit_item);
@@ -138,6 +145,8 @@ void fsweep::GameFrame::OnNew(wxCommandEvent& WXUNUSED(e))
   this->game_panel->DrawAll();
 }
 
+void fsweep::GameFrame::OnHint(wxCommandEvent& WXUNUSED(e)) { this->game_panel->ShowHint(); }
+
 void fsweep::GameFrame::OnBeginner(wxCommandEvent& WXUNUSED(e))
 {
   auto& game_model = this->view.get().GetGameModel();
@@ -205,6 +214,12 @@ void fsweep::GameFrame::OnQuestionMarks(wxCommandEvent& WXUNUSED(e))
   this->game_panel->DrawChanged();
 }
 
+void fsweep::GameFrame::OnRiskOverlay(wxCommandEvent& WXUNUSED(e))
+{
+  this->game_panel->SetOverlayShown(this->risk_overlay_item->IsChecked());
+  this->game_panel->DrawChanged();
+}
+
 void fsweep::GameFrame::OnPixelScale(wxCommandEvent& e)
 {
   const auto& desktop_model = this->view.get().GetDesktopModel();
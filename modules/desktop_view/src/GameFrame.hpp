@@ -41,6 +41,7 @@ namespace fsweep
     wxMenuItem* intermediate_item;
     wxMenuItem* expert_item;
     wxMenuItem* question_marks_item;
+    wxMenuItem* risk_overlay_item;
     fsweep::GamePanel* game_panel;
 
     void resizeGamePanel(int x, int y);
@@ -49,12 +50,14 @@ namespace fsweep
     GameFrame(fsweep::DesktopView& view);
 
     void OnNew(wxCommandEvent& e);
+    void OnHint(wxCommandEvent& e);
     void OnBeginner(wxCommandEvent& e);
     void OnIntermediate(wxCommandEvent& e);
     void OnExpert(wxCommandEvent& e);
     void OnCustom(wxCommandEvent& e);
     void OnPixelScale(wxCommandEvent& e);
     void OnQuestionMarks(wxCommandEvent& e);
+    void OnRiskOverlay(wxCommandEvent& e);
     void OnExit(wxCommandEvent& e);
     void OnCredits(wxCommandEvent& e);
     void OnLicense(wxCommandEvent& e);
@@ -22,13 +22,21 @@
 
 const int MILLISECONDS_PER_SECOND = 1000;
 const int TIMER_INTERVAL = MILLISECONDS_PER_SECOND / 15;
+const char* const HINT_EVENT_NAME = "Hint";
+const unsigned char TINT_ALPHA = 96;
 
 #include "GamePanel.hpp"
 #include "DesktopView.hpp"
+#include "LatencyMonitor.hpp"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <fsweep/Sprite.hpp>
 #include <fsweep/DesktopModel.hpp>
+#include <fsweep/Hint.hpp>
+#include <fsweep/RiskLayer.hpp>
+#include <fsweep/Trace.hpp>
 #include <functional>
 #include <optional>
 
@@ -50,17 +58,169 @@ wxBitmap& fsweep::GamePanel::getBitmap(fsweep::Sprite sprite)
   return this->scaled_bitmaps[static_cast<std::size_t>(sprite)];
 }
 
+void fsweep::GamePanel::createTintBitmaps()
+{
+  const auto& desktop_model = this->desktop_view.get().GetDesktopModel();
+  const auto button_dimension = desktop_model.GetButtonDimension();
+  this->tint_bitmaps.clear();
+  for (int level = 0; level < fsweep::RiskLayer::LEVEL_COUNT; level++)
+  {
+    const auto red = static_cast<unsigned char>(255 * level / (fsweep::RiskLayer::LEVEL_COUNT - 1));
+    wxImage image(button_dimension, button_dimension);
+    image.SetRGB(wxRect(0, 0, button_dimension, button_dimension), red, 255 - red, 0);
+    image.InitAlpha();
+    std::fill_n(image.GetAlpha(), button_dimension * button_dimension, TINT_ALPHA);
+    this->tint_bitmaps.emplace_back(image);
+  }
+}
+
+std::optional<fsweep::Hint> fsweep::GamePanel::getShownHint()
+{
+  if (!this->hint_shown) return std::nullopt;
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  if (game_model.GetGameNumber() != this->hint_game_number ||
+      game_model.GetBoardHash() != this->hint_board_hash)
+  {
+    this->hint_shown = false;
+    this->updateFrontierTracking();
+    return std::nullopt;
+  }
+  return this->hint_engine.GetHint(game_model);
+}
+
+// the frontier is kept up to date after each move so the hint thread only reads the numbers next
+// to covered Buttons, but it is only worth its memory while a hint or the risk overlay is shown
+void fsweep::GamePanel::updateFrontierTracking()
+{
+  auto& game_model = this->desktop_view.get().GetGameModel();
+  const auto frontier_tracking =
+      (this->hint_shown || this->overlay_shown) &&
+      fsweep::GameModel::GetMemoryEstimate(game_model.GetGameConfiguration(), true) <=
+          fsweep::GameModel::MAX_MEMORY_ESTIMATE;
+  game_model.SetFrontierTracking(frontier_tracking);
+}
+
+void fsweep::GamePanel::drawHint(wxDC& dc, const fsweep::Hint& hint)
+{
+  const auto& desktop_model = this->desktop_view.get().GetDesktopModel();
+  const auto point = desktop_model.GetButtonPoint(hint.x, hint.y);
+  const auto pixel_scale = desktop_model.GetPixelScale();
+  const auto button_dimension = desktop_model.GetButtonDimension();
+  const auto hint_colour = hint.GetIsSafe() ? wxColour(0, 192, 0) : wxColour(255, 128, 0);
+  dc.SetBrush(*wxTRANSPARENT_BRUSH);
+  dc.SetPen(wxPen(hint_colour, pixel_scale));
+  dc.DrawRectangle(point.x + pixel_scale, point.y + pixel_scale,
+                   button_dimension - (pixel_scale * 2), button_dimension - (pixel_scale * 2));
+}
+
+// draws a Button with the risk tint and the hint outline that belong on top of it
+void fsweep::GamePanel::drawButton(wxDC& dc, int x, int y, fsweep::Sprite button_sprite)
+{
+  const auto& desktop_model = this->desktop_view.get().GetDesktopModel();
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  const auto point = desktop_model.GetButtonPoint(x, y);
+  const wxPoint wx_point(point.x, point.y);
+  dc.DrawBitmap(this->getBitmap(button_sprite), wx_point, false);
+  const auto button_i = fsweep::ButtonPosition(x, y).GetIndex(
+      game_model.GetGameConfiguration().GetButtonsWide());
+  const auto& overlay_levels = this->game_panel_state.overlay_levels;
+  if (button_i < overlay_levels.size() && overlay_levels[button_i] != fsweep::RiskLayer::NO_LEVEL &&
+      game_model.GetButton(x, y).GetButtonState() != fsweep::ButtonState::Down)
+  {
+    dc.DrawBitmap(this->tint_bitmaps[overlay_levels[button_i]], wx_point, false);
+  }
+  const auto& hint = this->game_panel_state.hint;
+  if (hint && hint->x == x && hint->y == y) this->drawHint(dc, *hint);
+}
+
+void fsweep::GamePanel::drawButton(wxDC& dc, std::size_t button_i)
+{
+  const auto& desktop_model = this->desktop_view.get().GetDesktopModel();
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  const auto buttons_wide = game_model.GetGameConfiguration().GetButtonsWide();
+  const auto x = static_cast<int>(button_i % buttons_wide);
+  const auto y = static_cast<int>(button_i / buttons_wide);
+  this->drawButton(dc, x, y, desktop_model.GetButtonSprite(x, y));
+}
+
+void fsweep::GamePanel::updateHint(wxDC& dc)
+{
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  const auto buttons_wide = game_model.GetGameConfiguration().GetButtonsWide();
+  const auto hint = this->getShownHint();
+  const auto old_hint = this->game_panel_state.hint;
+  if (hint.has_value() == old_hint.has_value() &&
+      (!hint || (hint->x == old_hint->x && hint->y == old_hint->y &&
+                 hint->GetIsSafe() == old_hint->GetIsSafe())))
+  {
+    return;
+  }
+  this->game_panel_state.hint = hint;
+  // the hint of an earlier game may lie outside of this board, which DrawAll has redrawn anyway
+  if (old_hint && old_hint->game_number == game_model.GetGameNumber())
+  {
+    this->drawButton(dc,
+                     fsweep::ButtonPosition(old_hint->x, old_hint->y).GetIndex(buttons_wide));
+  }
+  if (hint) this->drawHint(dc, *hint);
+}
+
+// redraws only the Buttons whose risk level the HintEngine changed since the last update
+void fsweep::GamePanel::updateOverlay(wxDC& dc)
+{
+  if (!this->overlay_shown) return;
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  if (!this->hint_engine.TakeRiskChanges(game_model, this->risk_changes)) return;
+  auto& overlay_levels = this->game_panel_state.overlay_levels;
+  const auto button_count = game_model.GetGameConfiguration().GetButtonCount();
+  if (overlay_levels.size() != button_count)
+  {
+    overlay_levels.assign(button_count, fsweep::RiskLayer::NO_LEVEL);
+  }
+  [[maybe_unused]] int overlay_blit_count = 0;
+  for (const auto& [button_i, level] : this->risk_changes)
+  {
+    // the changes describe the current board, but a Button outside of it must never be written
+    if (button_i >= overlay_levels.size() || overlay_levels[button_i] == level) continue;
+    overlay_levels[button_i] = level;
+    this->drawButton(dc, button_i);
+    overlay_blit_count++;
+  }
+  FSWEEP_TRACE_COUNTER("GamePanel::updateOverlay button blits", overlay_blit_count);
+}
+
+void fsweep::GamePanel::onHint()
+{
+#ifdef FSWEEP_MEASURE_LATENCY
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  const auto hint = this->hint_engine.GetHint(game_model);
+  if (hint)
+  {
+    fsweep::LatencyMonitor::GetInstance().RecordWorker(game_model.GetGameConfiguration(),
+                                                       HINT_EVENT_NAME, hint->latency_us);
+  }
+#endif
+  this->DrawChanged();
+}
+
 fsweep::GamePanel::GamePanel(fsweep::DesktopView& desktop_view, wxFrame* parent, int width,
                              int height)
     : wxPanel(parent, wxID_ANY), desktop_view(std::ref(desktop_view)), timer(this)
 {
   Bind(wxEVT_TIMER, &GamePanel::OnTimer, this, this->timer.GetTimer().GetId());
+  this->hint_engine.SetHintListener(
+      [this]()
+      {
+        // the listener runs on the hint thread, the hint is drawn from the event loop
+        this->CallAfter([this]() { this->onHint(); });
+      });
   for (std::size_t bitmap_i = 0; bitmap_i < static_cast<std::size_t>(fsweep::Sprite::Count);
        bitmap_i++)
   {
     this->base_bitmaps[bitmap_i] = wxBitmap(fsweep::SPRITESHEET_XPM_DATA[bitmap_i]);
     this->scaled_bitmaps[bitmap_i] = wxBitmap(this->base_bitmaps[bitmap_i]);
   }
+  this->createTintBitmaps();
   this->SetSize(wxSize(width, height));
 }
 
@@ -70,6 +230,8 @@ void fsweep::GamePanel::OnRender(wxPaintEvent& WXUNUSED(e)) { this->DrawAll(); }
 
 void fsweep::GamePanel::OnMouseMove(wxMouseEvent& e)
 {
+  FSWEEP_TRACE_ZONE("GamePanel::OnMouseMove");
+  FSWEEP_LATENCY_SCOPE(this->desktop_view.get().GetGameModel(), "MouseMove");
   auto& desktop_model = this->desktop_view.get().GetDesktopModel();
   wxPoint mouse_position = e.GetPosition();
   desktop_model.MouseMove(mouse_position.x, mouse_position.y);
@@ -78,6 +240,8 @@ void fsweep::GamePanel::OnMouseMove(wxMouseEvent& e)
 
 void fsweep::GamePanel::OnLeftPress(wxMouseEvent& WXUNUSED(e))
 {
+  FSWEEP_TRACE_ZONE("GamePanel::OnLeftPress");
+  FSWEEP_LATENCY_SCOPE(this->desktop_view.get().GetGameModel(), "LeftPress");
   auto& desktop_model = this->desktop_view.get().GetDesktopModel();
   desktop_model.LeftPress();
   if (!this->HasCapture())
@@ -89,6 +253,8 @@ void fsweep::GamePanel::OnLeftPress(wxMouseEvent& WXUNUSED(e))
 
 void fsweep::GamePanel::OnLeftRelease(wxMouseEvent& WXUNUSED(e))
 {
+  FSWEEP_TRACE_ZONE("GamePanel::OnLeftRelease");
+  FSWEEP_LATENCY_SCOPE(this->desktop_view.get().GetGameModel(), "LeftRelease");
   auto& desktop_model = this->desktop_view.get().GetDesktopModel();
   desktop_model.LeftRelease(this->timer);
   if (this->HasCapture())
@@ -100,6 +266,8 @@ void fsweep::GamePanel::OnLeftRelease(wxMouseEvent& WXUNUSED(e))
 
 void fsweep::GamePanel::OnRightPress(wxMouseEvent& WXUNUSED(e))
 {
+  FSWEEP_TRACE_ZONE("GamePanel::OnRightPress");
+  FSWEEP_LATENCY_SCOPE(this->desktop_view.get().GetGameModel(), "RightPress");
   auto& desktop_model = this->desktop_view.get().GetDesktopModel();
   desktop_model.RightPress(this->timer);
   if (!this->HasCapture())
@@ -111,6 +279,8 @@ void fsweep::GamePanel::OnRightPress(wxMouseEvent& WXUNUSED(e))
 
 void fsweep::GamePanel::OnRightRelease(wxMouseEvent& WXUNUSED(e))
 {
+  FSWEEP_TRACE_ZONE("GamePanel::OnRightRelease");
+  FSWEEP_LATENCY_SCOPE(this->desktop_view.get().GetGameModel(), "RightRelease");
   auto& desktop_model = this->desktop_view.get().GetDesktopModel();
   desktop_model.RightRelease(this->timer);
   if (this->HasCapture())
@@ -122,6 +292,8 @@ void fsweep::GamePanel::OnRightRelease(wxMouseEvent& WXUNUSED(e))
 
 void fsweep::GamePanel::OnMouseLeave(wxMouseEvent& WXUNUSED(e))
 {
+  FSWEEP_TRACE_ZONE("GamePanel::OnMouseLeave");
+  FSWEEP_LATENCY_SCOPE(this->desktop_view.get().GetGameModel(), "MouseLeave");
   auto& desktop_model = this->desktop_view.get().GetDesktopModel();
   desktop_model.MouseLeave();
   this->DrawChanged();
@@ -129,6 +301,7 @@ void fsweep::GamePanel::OnMouseLeave(wxMouseEvent& WXUNUSED(e))
 
 void fsweep::GamePanel::OnTimer(wxTimerEvent& WXUNUSED(e))
 {
+  FSWEEP_TRACE_ZONE("GamePanel::OnTimer");
   auto& game_model = this->desktop_view.get().GetGameModel();
   game_model.UpdateTime(this->timer.GetGameTime());
   this->DrawChanged(true);
@@ -148,6 +321,7 @@ bool fsweep::GamePanel::TryChangePixelScale(int new_pixel_scale)
                     base_bitmap.GetHeight() * new_pixel_scale);
       this->scaled_bitmaps[bitmap_i] = wxBitmap(image);
     }
+    this->createTintBitmaps();
     return true;
   }
   else
@@ -160,8 +334,46 @@ int fsweep::GamePanel::GetPixelScale() const noexcept
   return desktop_model.GetPixelScale();
 }
 
+void fsweep::GamePanel::ShowHint()
+{
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  this->hint_shown = true;
+  this->hint_game_number = game_model.GetGameNumber();
+  this->hint_board_hash = game_model.GetBoardHash();
+  this->updateFrontierTracking();
+  this->hint_engine.Request(game_model);
+  this->DrawChanged();
+}
+
+void fsweep::GamePanel::SetOverlayShown(bool overlay_shown)
+{
+  if (this->overlay_shown == overlay_shown) return;
+  const auto& game_model = this->desktop_view.get().GetGameModel();
+  this->overlay_shown = overlay_shown;
+  this->updateFrontierTracking();
+  this->hint_engine.SetRiskTracking(overlay_shown);
+  auto& overlay_levels = this->game_panel_state.overlay_levels;
+  if (overlay_shown)
+  {
+    overlay_levels.assign(game_model.GetGameConfiguration().GetButtonCount(),
+                          fsweep::RiskLayer::NO_LEVEL);
+    this->hint_engine.Request(game_model);
+    return;
+  }
+  wxClientDC dc(this);
+  for (std::size_t button_i = 0; button_i < overlay_levels.size(); button_i++)
+  {
+    if (overlay_levels[button_i] == fsweep::RiskLayer::NO_LEVEL) continue;
+    overlay_levels[button_i] = fsweep::RiskLayer::NO_LEVEL;
+    this->drawButton(dc, button_i);
+  }
+}
+
+bool fsweep::GamePanel::GetOverlayShown() const noexcept { return this->overlay_shown; }
+
 void fsweep::GamePanel::DrawAll()
 {
+  FSWEEP_TRACE_ZONE("GamePanel::DrawAll");
   const auto& desktop_model = this->desktop_view.get().GetDesktopModel();
   const auto& game_model = this->desktop_view.get().GetGameModel();
   fsweep::Point point;
@@ -253,24 +465,38 @@ void fsweep::GamePanel::DrawAll()
   wx_point = wxPoint(point.x, point.y);
   dc.DrawBitmap(this->getBitmap(face_sprite), wx_point, false);
   this->game_panel_state.face_sprite = face_sprite;
-  this->game_panel_state.button_sprites.clear();
-  this->game_panel_state.button_sprites.reserve(
-      game_model.GetGameConfiguration().GetButtonCount());
-  for (int x = 0; x < game_model.GetGameConfiguration().GetButtonsWide(); x++)
+  const auto buttons_wide = game_model.GetGameConfiguration().GetButtonsWide();
+  const auto button_count = game_model.GetGameConfiguration().GetButtonCount();
+  this->game_panel_state.button_sprites.assign(button_count, fsweep::Sprite());
+  // the levels of a board with other dimensions are dropped, the HintEngine sends them all again
+  auto& overlay_levels = this->game_panel_state.overlay_levels;
+  if (!this->overlay_shown)
+  {
+    overlay_levels.clear();
+  }
+  else if (overlay_levels.size() != button_count)
+  {
+    overlay_levels.assign(button_count, fsweep::RiskLayer::NO_LEVEL);
+  }
+  // a hint is requested once by ShowHint, only the risk overlay has to follow every board
+  if (this->overlay_shown) this->hint_engine.Request(game_model);
+  this->game_panel_state.hint = this->getShownHint();
+  for (int x = 0; x < buttons_wide; x++)
   {
     for (int y = 0; y < game_model.GetGameConfiguration().GetButtonsTall(); y++)
     {
       const auto button_sprite = desktop_model.GetButtonSprite(x, y);
-      point = desktop_model.GetButtonPoint(x, y);
-      wx_point = wxPoint(point.x, point.y);
-      dc.DrawBitmap(this->getBitmap(desktop_model.GetButtonSprite(x, y)), wx_point, false);
-      this->game_panel_state.button_sprites.push_back(button_sprite);
+      this->drawButton(dc, x, y, button_sprite);
+      this->game_panel_state.button_sprites[fsweep::ButtonPosition(x, y).GetIndex(buttons_wide)] =
+          button_sprite;
     }
   }
+  this->updateOverlay(dc);
 }
 
 void fsweep::GamePanel::DrawChanged(bool timer_only)
 {
+  FSWEEP_TRACE_ZONE("GamePanel::DrawChanged");
   fsweep::Point point;
   wxPoint wx_point;
   const auto& game_model = this->desktop_view.get().GetGameModel();
@@ -310,6 +536,7 @@ void fsweep::GamePanel::DrawChanged(bool timer_only)
     dc.DrawBitmap(this->getBitmap(face_sprite), wx_point, false);
     this->game_panel_state.face_sprite = face_sprite;
   }
+  [[maybe_unused]] int button_blit_count = 0;
   for (int x = 0; x < game_model.GetGameConfiguration().GetButtonsWide(); x++)
   {
     for (int y = 0; y < game_model.GetGameConfiguration().GetButtonsTall(); y++)
@@ -319,12 +546,17 @@ void fsweep::GamePanel::DrawChanged(bool timer_only)
       if (button_sprite !=
           this->game_panel_state.button_sprites[button_position.GetIndex(buttons_wide)])
       {
-        point = desktop_model.GetButtonPoint(x, y);
-        wx_point = wxPoint(point.x, point.y);
-        dc.DrawBitmap(this->getBitmap(button_sprite), wx_point, false);
+        this->drawButton(dc, x, y, button_sprite);
         this->game_panel_state.button_sprites[button_position.GetIndex(buttons_wide)] =
             button_sprite;
+        button_blit_count++;
       }
     }
   }
-}
\ No newline at end of file
+  FSWEEP_TRACE_COUNTER("GamePanel::DrawChanged button blits", button_blit_count);
+  // copying the board for the HintEngine is only worth it while the risk overlay is shown, and
+  // analysing a board that did not change is skipped by the HintEngine
+  if (this->overlay_shown) this->hint_engine.Request(game_model);
+  this->updateHint(dc);
+  this->updateOverlay(dc);
+}
@@ -24,9 +24,14 @@
 #define FSWEEP_GAME_PANEL_HPP
 
 #include <array>
+#include <cstdint>
 #include <fsweep/ButtonPosition.hpp>
+#include <fsweep/Hint.hpp>
+#include <fsweep/HintEngine.hpp>
 #include <functional>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "DesktopTimer.hpp"
 #include "GamePanelState.hpp"
@@ -45,7 +50,26 @@ namespace fsweep
     std::array<wxBitmap, static_cast<std::size_t>(fsweep::Sprite::Count)> base_bitmaps;
     std::array<wxBitmap, static_cast<std::size_t>(fsweep::Sprite::Count)> scaled_bitmaps;
     fsweep::GamePanelState game_panel_state;
+    // a hint is shown from the Hint action until the board changes or a new game is started
+    bool hint_shown = false;
+    std::uint64_t hint_game_number = 0;
+    std::uint64_t hint_board_hash = 0;
+    bool overlay_shown = false;
+    // one translucent square per risk level, blended over covered Buttons
+    std::vector<wxBitmap> tint_bitmaps;
+    std::vector<std::pair<std::size_t, std::uint8_t>> risk_changes;
+    // declared last so its thread stops before the rest of the panel is destroyed
+    fsweep::HintEngine hint_engine;
     wxBitmap& getBitmap(fsweep::Sprite sprite);
+    void createTintBitmaps();
+    std::optional<fsweep::Hint> getShownHint();
+    void updateFrontierTracking();
+    void drawHint(wxDC& dc, const fsweep::Hint& hint);
+    void drawButton(wxDC& dc, int x, int y, fsweep::Sprite button_sprite);
+    void drawButton(wxDC& dc, std::size_t button_i);
+    void updateHint(wxDC& dc);
+    void updateOverlay(wxDC& dc);
+    void onHint();
 
    public:
     GamePanel(fsweep::DesktopView& desktop_view, wxFrame* parent, int width, int height);
@@ -62,6 +86,9 @@ namespace fsweep
 
     bool TryChangePixelScale(int new_pixel_scale);
     int GetPixelScale() const noexcept;
+    void ShowHint();
+    void SetOverlayShown(bool overlay_shown);
+    bool GetOverlayShown() const noexcept;
     void DrawAll();
     void DrawChanged(bool timer_only = false);
 
@@ -24,6 +24,9 @@
 #define FSWEEP_GAME_PANEL_STATE_HPP
 
 #include <array>
+#include <cstdint>
+#include <fsweep/Hint.hpp>
+#include <optional>
 #include <vector>
 
 #include "spritesheet.hpp"
@@ -36,6 +39,9 @@ namespace fsweep
     std::vector<fsweep::Sprite> button_sprites = std::vector<fsweep::Sprite>();
     std::array<fsweep::Sprite, 3> score_lcd = std::array<fsweep::Sprite, 3>();
     std::array<fsweep::Sprite, 3> time_lcd = std::array<fsweep::Sprite, 3>();
+    std::optional<fsweep::Hint> hint = std::optional<fsweep::Hint>();
+    // the risk level each Button is tinted with, RiskLayer::NO_LEVEL when it is not tinted
+    std::vector<std::uint8_t> overlay_levels = std::vector<std::uint8_t>();
 
     constexpr GamePanelState() noexcept = default;
   };
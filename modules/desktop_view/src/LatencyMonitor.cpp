@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "LatencyMonitor.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/LatencyHistogram.hpp>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+const std::string ALL_EVENTS_NAME = "all";
+
+fsweep::LatencyMonitor& fsweep::LatencyMonitor::GetInstance()
+{
+  static fsweep::LatencyMonitor latency_monitor;
+  return latency_monitor;
+}
+
+namespace
+{
+  std::string getBoardName(const fsweep::GameConfiguration& game_configuration)
+  {
+    return std::to_string(game_configuration.GetButtonsWide()) + "x" +
+           std::to_string(game_configuration.GetButtonsTall());
+  }
+
+  void writeLatencyRow(std::ostream& stream, const std::string& board_name,
+                       const std::string& event_name,
+                       const fsweep::LatencyHistogram& latency_histogram)
+  {
+    stream << std::left << std::setw(14) << board_name << std::setw(16) << event_name << std::right
+           << std::setw(10) << latency_histogram.GetCount() << std::setw(10)
+           << latency_histogram.GetValueAtPercentile(50.0) << std::setw(10)
+           << latency_histogram.GetValueAtPercentile(99.0) << std::setw(10)
+           << latency_histogram.GetValueAtPercentile(99.9) << std::setw(10)
+           << latency_histogram.GetMax() << "\n";
+  }
+}  // namespace
+
+void fsweep::LatencyMonitor::Record(const fsweep::GameConfiguration& game_configuration,
+                                    const char* event_name, std::uint64_t latency_us)
+{
+  this->histograms[getBoardName(game_configuration)][event_name].Record(latency_us);
+}
+
+void fsweep::LatencyMonitor::RecordWorker(const fsweep::GameConfiguration& game_configuration,
+                                          const char* event_name, std::uint64_t latency_us)
+{
+  this->worker_histograms[getBoardName(game_configuration)][event_name].Record(latency_us);
+}
+
+void fsweep::LatencyMonitor::Write(std::ostream& stream) const
+{
+  stream << std::left << std::setw(14) << "board" << std::setw(16) << "event" << std::right
+         << std::setw(10) << "count" << std::setw(10) << "p50_us" << std::setw(10) << "p99_us"
+         << std::setw(10) << "p999_us" << std::setw(10) << "max_us"
+         << "\n";
+  for (const auto& [board_name, event_histograms] : this->histograms)
+  {
+    fsweep::LatencyHistogram all_histogram;
+    for (const auto& [event_name, latency_histogram] : event_histograms)
+    {
+      all_histogram.Merge(latency_histogram);
+    }
+    writeLatencyRow(stream, board_name, ALL_EVENTS_NAME, all_histogram);
+    for (const auto& [event_name, latency_histogram] : event_histograms)
+    {
+      writeLatencyRow(stream, board_name, event_name, latency_histogram);
+    }
+  }
+  for (const auto& [board_name, event_histograms] : this->worker_histograms)
+  {
+    for (const auto& [event_name, latency_histogram] : event_histograms)
+    {
+      writeLatencyRow(stream, board_name, event_name, latency_histogram);
+    }
+  }
+}
+
+bool fsweep::LatencyMonitor::Write(std::string_view path) const
+{
+  std::ofstream stream{std::string(path)};
+  if (!stream) return false;
+  this->Write(stream);
+  return static_cast<bool>(stream);
+}
+
+fsweep::LatencyScope::LatencyScope(const fsweep::GameModel& game_model,
+                                   const char* event_name) noexcept
+    : game_model(std::cref(game_model))
+    , event_name(event_name)
+    , start_time(std::chrono::steady_clock::now())
+{
+}
+
+fsweep::LatencyScope::~LatencyScope()
+{
+  const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - this->start_time);
+  fsweep::LatencyMonitor::GetInstance().Record(this->game_model.get().GetGameConfiguration(),
+                                               this->event_name,
+                                               static_cast<std::uint64_t>(latency.count()));
+}
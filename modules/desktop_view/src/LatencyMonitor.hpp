@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_LATENCY_MONITOR_HPP
+#define FSWEEP_LATENCY_MONITOR_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/LatencyHistogram.hpp>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace fsweep
+{
+  class GameModel;
+
+  class LatencyMonitor
+  {
+   private:
+    std::map<std::string, std::map<std::string, fsweep::LatencyHistogram>> histograms =
+        std::map<std::string, std::map<std::string, fsweep::LatencyHistogram>>();
+    // work done off the event loop is not input-to-pixel latency, so it stays out of "all"
+    std::map<std::string, std::map<std::string, fsweep::LatencyHistogram>> worker_histograms =
+        std::map<std::string, std::map<std::string, fsweep::LatencyHistogram>>();
+
+   public:
+    LatencyMonitor() noexcept = default;
+
+    static fsweep::LatencyMonitor& GetInstance();
+
+    void Record(const fsweep::GameConfiguration& game_configuration, const char* event_name,
+                std::uint64_t latency_us);
+    void RecordWorker(const fsweep::GameConfiguration& game_configuration,
+                      const char* event_name, std::uint64_t latency_us);
+    void Write(std::ostream& stream) const;
+    bool Write(std::string_view path) const;
+  };
+
+  class LatencyScope
+  {
+   private:
+    std::reference_wrapper<const fsweep::GameModel> game_model;
+    const char* event_name;
+    std::chrono::steady_clock::time_point start_time;
+
+   public:
+    LatencyScope(const fsweep::GameModel& game_model, const char* event_name) noexcept;
+    LatencyScope(const fsweep::LatencyScope&) = delete;
+    LatencyScope& operator=(const fsweep::LatencyScope&) = delete;
+    ~LatencyScope();
+  };
+}  // namespace fsweep
+
+#ifdef FSWEEP_MEASURE_LATENCY
+#  define FSWEEP_LATENCY_SCOPE(game_model, event_name) \
+    const fsweep::LatencyScope fsweep_latency_scope(game_model, event_name)
+#else
+#  define FSWEEP_LATENCY_SCOPE(game_model, event_name)
+#endif
+
+#endif
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_ACTION_JOURNAL_HPP
+#define FSWEEP_ACTION_JOURNAL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/ButtonState.hpp>
+#include <fsweep/GameAction.hpp>
+#include <fsweep/GameState.hpp>
+#include <vector>
+
+namespace fsweep
+{
+  // Two preallocated ring buffers of the actions applied to a GameModel and the ButtonState every
+  // Button had before an action changed it. When a ring is full the oldest actions are dropped,
+  // and an action that does not fit on its own empties the journal. Undone actions stay in the
+  // action ring until the next new action that changes a Button so they can be redone.
+  class ActionJournal
+  {
+   public:
+    struct Action
+    {
+      fsweep::GameAction game_action;
+      int x, y;
+      fsweep::GameState game_state;
+      int flag_count;
+      std::int64_t buttons_left;
+      bool placed_bombs;
+      std::size_t change_count;
+    };
+
+   private:
+    std::vector<fsweep::ActionJournal::Action> actions =
+        std::vector<fsweep::ActionJournal::Action>();
+    std::vector<std::uint64_t> changes = std::vector<std::uint64_t>();
+    std::size_t first_action_i = 0;
+    std::size_t action_count = 0;
+    std::size_t redo_count = 0;
+    std::size_t first_change_i = 0;
+    std::size_t change_count = 0;
+    // an action only takes its place in the ring, dropping the undone actions, once it changes a
+    // Button, so an action that changes nothing leaves the journal as it was
+    fsweep::ActionJournal::Action pending_action = fsweep::ActionJournal::Action();
+    bool pending = false;
+    bool recording = false;
+    bool redoing = false;
+    bool overflowed = false;
+
+    fsweep::ActionJournal::Action& getLastAction() noexcept;
+    void dropFirstAction() noexcept;
+    void pushPendingAction() noexcept;
+
+   public:
+    ActionJournal() noexcept = default;
+    ActionJournal(std::size_t action_capacity, std::size_t change_capacity);
+
+    void BeginAction(const fsweep::ActionJournal::Action& action) noexcept;
+    void AddChange(std::size_t button_i, fsweep::ButtonState button_state) noexcept;
+    void EndAction() noexcept;
+    void BeginRedo() noexcept;
+    bool PopChange(std::size_t& button_i, fsweep::ButtonState& button_state) noexcept;
+    void PopAction() noexcept;
+    void Clear() noexcept;
+    bool GetIsRecording() const noexcept;
+    bool GetCanUndo() const noexcept;
+    bool GetCanRedo() const noexcept;
+    const fsweep::ActionJournal::Action& GetUndoAction() const noexcept;
+    const fsweep::ActionJournal::Action& GetRedoAction() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
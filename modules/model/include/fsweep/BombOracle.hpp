@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_BOMB_ORACLE_HPP
+#define FSWEEP_BOMB_ORACLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/Button.hpp>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/ThreadPool.hpp>
+
+namespace fsweep
+{
+  // answers where the bombs of a board are from its seed alone, so a board of any size can be
+  // checked or drawn without storing its Buttons
+  class BombOracle
+  {
+   private:
+    fsweep::GameConfiguration game_configuration = fsweep::GameConfiguration();
+    std::uint64_t seed = 0;
+    fsweep::ButtonPosition initial_position = fsweep::ButtonPosition();
+    std::uint64_t bomb_count = 0;
+    std::uint64_t max_bomb_hash = 0;
+
+    static std::uint64_t getFractionHash(double fraction) noexcept;
+    void findMaxBombHash(fsweep::ThreadPool& thread_pool);
+
+   public:
+    static std::uint64_t GetHash(std::uint64_t seed, std::int64_t x, std::int64_t y) noexcept;
+    static std::uint64_t GetBombThreshold(double bomb_density) noexcept;
+    static bool HasBomb(std::uint64_t seed, std::int64_t x, std::int64_t y,
+                        std::uint64_t bomb_threshold) noexcept;
+
+    BombOracle(fsweep::GameConfiguration game_configuration, std::uint64_t seed);
+    BombOracle(fsweep::GameConfiguration game_configuration, std::uint64_t seed, int initial_x,
+               int initial_y);
+    BombOracle(fsweep::GameConfiguration game_configuration, std::uint64_t seed, int initial_x,
+               int initial_y, fsweep::ThreadPool& thread_pool);
+
+    bool HasBomb(int x, int y) const noexcept;
+    int GetSurroundingBombs(int x, int y) const noexcept;
+    fsweep::Button GetButton(int x, int y) const noexcept;
+    std::uint64_t GetBombCount() const noexcept;
+    std::uint64_t GetSeed() const noexcept;
+    fsweep::GameConfiguration GetGameConfiguration() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
@@ -23,32 +23,46 @@
 #ifndef FSWEEP_BUTTON_HPP
 #define FSWEEP_BUTTON_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <fsweep/ButtonState.hpp>
+#include <span>
+#include <string_view>
 
 namespace fsweep
 {
   class Button
   {
    private:
-    fsweep::ButtonState button_state = fsweep::ButtonState::Default;
-    bool has_bomb = false;
-    int surrounding_bombs = 0;
+    // bits 0-1 are the ButtonState, bit 2 is the bomb, bits 3-6 are the surrounding bombs and bit 7
+    // marks that the surrounding bombs have been counted
+    std::uint8_t bits = 0;
 
    public:
     constexpr Button() noexcept = default;
     Button(char c) noexcept;
+    Button(fsweep::ButtonState button_state, bool has_bomb) noexcept;
 
     void Unpress() noexcept;
     void Press() noexcept;
     void AltPress(bool questions_enabled) noexcept;
     void RemoveQuestion() noexcept;
+    void SetButtonState(fsweep::ButtonState button_state) noexcept;
     void SetHasBomb(bool has_bomb) noexcept;
     void SetSurroundingBombs(int surrounding_bombs) noexcept;
     void AddSurroundingBomb() noexcept;
+    void SetIsCounted(bool is_counted) noexcept;
     bool GetIsPressable() const noexcept;
     bool GetHasBomb() const noexcept;
     int GetSurroundingBombs() const noexcept;
+    bool GetIsCounted() const noexcept;
     fsweep::ButtonState GetButtonState() const noexcept;
+    char ToChar() const noexcept;
+
+    static void FromChars(std::string_view chars, std::span<fsweep::Button> buttons) noexcept;
+    static void ToChars(std::span<const fsweep::Button> buttons, std::span<char> chars) noexcept;
+    static std::size_t CountButtonState(std::span<const fsweep::Button> buttons,
+                                        fsweep::ButtonState button_state) noexcept;
   };
 }  // namespace fsweep
 
@@ -109,7 +109,8 @@ namespace fsweep
 
     constexpr std::size_t GetIndex(const int buttons_wide) const noexcept
     {
-      return static_cast<std::size_t>((buttons_wide * this->y) + this->x);
+      return (static_cast<std::size_t>(buttons_wide) * static_cast<std::size_t>(this->y)) +
+             static_cast<std::size_t>(this->x);
     }
 
     constexpr bool operator==(const ButtonPosition& other) const noexcept
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_COUNTER_RNG_HPP
+#define FSWEEP_COUNTER_RNG_HPP
+
+#include <cstdint>
+
+namespace fsweep
+{
+  // a stateless random number generator, every value is derived from a seed and a counter so any
+  // part of a board can be generated independently and in any order
+  class CounterRng
+  {
+   public:
+    static constexpr std::uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+    static constexpr std::uint64_t Mix(std::uint64_t value) noexcept
+    {
+      value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+      return value ^ (value >> 31);
+    }
+
+    static constexpr std::uint64_t Get(std::uint64_t seed, std::uint64_t counter) noexcept
+    {
+      return fsweep::CounterRng::Mix(seed + ((counter + 1) * fsweep::CounterRng::GOLDEN_GAMMA));
+    }
+
+    static constexpr std::uint64_t Get(std::uint64_t seed, std::uint64_t x,
+                                       std::uint64_t y) noexcept
+    {
+      return fsweep::CounterRng::Get(fsweep::CounterRng::Get(seed, x), y);
+    }
+  };
+}  // namespace fsweep
+
+#endif
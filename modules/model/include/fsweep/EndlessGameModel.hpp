@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_ENDLESS_GAME_MODEL_HPP
+#define FSWEEP_ENDLESS_GAME_MODEL_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/Button.hpp>
+#include <fsweep/GameState.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace fsweep
+{
+  struct EndlessPosition
+  {
+    std::int64_t x = 0;
+    std::int64_t y = 0;
+
+    bool operator==(const fsweep::EndlessPosition& other) const noexcept = default;
+  };
+
+  struct EndlessPositionHash
+  {
+    std::size_t operator()(const fsweep::EndlessPosition& position) const noexcept;
+  };
+
+  class EndlessGameModel
+  {
+   public:
+    static constexpr int CHUNK_BUTTONS_WIDE = 64;
+    static constexpr int CHUNK_BUTTONS_TALL = 64;
+    static const double MIN_BOMB_DENSITY;
+    static const double MAX_BOMB_DENSITY;
+    static const double DEFAULT_BOMB_DENSITY;
+
+   private:
+    using Chunk = std::array<fsweep::Button, fsweep::EndlessGameModel::CHUNK_BUTTONS_WIDE *
+                                                 fsweep::EndlessGameModel::CHUNK_BUTTONS_TALL>;
+
+    std::unordered_map<fsweep::EndlessPosition, Chunk, fsweep::EndlessPositionHash> chunks =
+        std::unordered_map<fsweep::EndlessPosition, Chunk, fsweep::EndlessPositionHash>();
+    std::uint64_t seed = 0;
+    double bomb_density = 0;
+    std::uint64_t bomb_threshold = 0;
+    fsweep::EndlessPosition first_position = fsweep::EndlessPosition();
+    fsweep::GameState game_state = fsweep::GameState::Default;
+    bool questions_enabled = false;
+    std::int64_t flag_count = 0;
+    std::uint64_t buttons_pressed = 0;
+    std::vector<fsweep::EndlessPosition> flood_fill_stack = std::vector<fsweep::EndlessPosition>();
+
+    static fsweep::EndlessPosition getChunkPosition(std::int64_t x, std::int64_t y) noexcept;
+    static std::size_t getChunkIndex(std::int64_t x, std::int64_t y) noexcept;
+    fsweep::Button makeButton(std::int64_t x, std::int64_t y) const noexcept;
+    Chunk& getChunk(const fsweep::EndlessPosition& chunk_position);
+    fsweep::Button& getButton(std::int64_t x, std::int64_t y);
+    void refreshButtons(std::int64_t x, std::int64_t y);
+    void pressButton(std::int64_t x, std::int64_t y);
+    void floodFillClick(std::int64_t x, std::int64_t y);
+
+   public:
+    EndlessGameModel(std::uint64_t seed, double bomb_density);
+
+    void NewGame();
+    void NewGame(std::uint64_t seed);
+    void ClickButton(std::int64_t x, std::int64_t y);
+    void AltClickButton(std::int64_t x, std::int64_t y);
+    void AreaClickButton(std::int64_t x, std::int64_t y);
+    void SetQuestionsEnabled(bool questions_enabled);
+    bool GetQuestionsEnabled() const noexcept;
+    bool HasBomb(std::int64_t x, std::int64_t y) const noexcept;
+    fsweep::Button GetButton(std::int64_t x, std::int64_t y) const noexcept;
+    fsweep::GameState GetGameState() const noexcept;
+    std::int64_t GetFlagCount() const noexcept;
+    std::uint64_t GetButtonsPressed() const noexcept;
+    std::uint64_t GetSeed() const noexcept;
+    double GetBombDensity() const noexcept;
+    std::size_t GetChunkCount() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_FRONTIER_SOLVER_HPP
+#define FSWEEP_FRONTIER_SOLVER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace fsweep
+{
+  // Finds the Buttons that every arrangement of bombs satisfying the constraints agrees on by
+  // Gaussian elimination. Each constraint says how many bombs hide among some Buttons and becomes
+  // a row with one column per Button. The constraints are split into independent components and
+  // each component is reduced with fraction free integer row operations, where a packed bitset of
+  // the non zero columns of each row lets the elimination skip rows and words that do not take
+  // part. A reduced row whose value is its lowest or highest possible sum decides all its Buttons.
+  class FrontierSolver
+  {
+   private:
+    std::vector<std::size_t> button_is = std::vector<std::size_t>();
+    std::vector<std::size_t> constraint_starts = std::vector<std::size_t>();
+    std::vector<int> bomb_counts = std::vector<int>();
+    std::vector<std::size_t> safe_button_is = std::vector<std::size_t>();
+    std::vector<std::size_t> bomb_button_is = std::vector<std::size_t>();
+    std::vector<std::int32_t> coefficients = std::vector<std::int32_t>();
+    std::vector<std::int32_t> values = std::vector<std::int32_t>();
+    std::vector<std::uint64_t> supports = std::vector<std::uint64_t>();
+
+    bool solveComponent(std::span<const std::size_t> constraint_is,
+                        std::span<const std::size_t> column_button_is);
+
+   public:
+    static const std::size_t MAX_COMPONENT_COLUMNS;
+
+    FrontierSolver() noexcept = default;
+
+    void AddConstraint(std::span<const std::size_t> button_is, int bomb_count);
+    void Clear() noexcept;
+    void Solve();
+    std::span<const std::size_t> GetSafeButtons() const noexcept;
+    std::span<const std::size_t> GetBombButtons() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
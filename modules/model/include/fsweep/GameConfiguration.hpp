@@ -24,6 +24,7 @@
 #define FSWEEP_GAME_CONFIGURATION_HPP
 
 #include <compare>
+#include <cstddef>
 #include <fsweep/GameDifficulty.hpp>
 
 namespace fsweep
@@ -31,18 +32,20 @@ namespace fsweep
   class GameConfiguration
   {
    public:
-    static const int BEGINNER_BUTTONS_WIDE;
-    static const int BEGINNER_BUTTONS_TALL;
-    static const int BEGINNER_BOMB_COUNT;
-    static const int INTERMEDIATE_BUTTONS_WIDE;
-    static const int INTERMEDIATE_BUTTONS_TALL;
-    static const int INTERMEDIATE_BOMB_COUNT;
-    static const int EXPERT_BUTTONS_WIDE;
-    static const int EXPERT_BUTTONS_TALL;
-    static const int EXPERT_BOMB_COUNT;
-    static const int MIN_BUTTONS_WIDE;
-    static const int MIN_BUTTONS_TALL;
-    static const int MIN_BOMB_COUNT;
+    static constexpr int BEGINNER_BUTTONS_WIDE = 8;
+    static constexpr int BEGINNER_BUTTONS_TALL = 8;
+    static constexpr int BEGINNER_BOMB_COUNT = 10;
+    static constexpr int INTERMEDIATE_BUTTONS_WIDE = 16;
+    static constexpr int INTERMEDIATE_BUTTONS_TALL = 16;
+    static constexpr int INTERMEDIATE_BOMB_COUNT = 40;
+    static constexpr int EXPERT_BUTTONS_WIDE = 30;
+    static constexpr int EXPERT_BUTTONS_TALL = 16;
+    static constexpr int EXPERT_BOMB_COUNT = 99;
+    static constexpr int MIN_BUTTONS_WIDE = 8;
+    static constexpr int MIN_BUTTONS_TALL = 1;
+    static constexpr int MIN_BOMB_COUNT = 0;
+    static constexpr int MAX_BUTTONS_WIDE = 65536;
+    static constexpr int MAX_BUTTONS_TALL = 65536;
 
    private:
     fsweep::GameDifficulty game_difficulty = fsweep::GameDifficulty::Default;
@@ -63,7 +66,7 @@ namespace fsweep
     int GetButtonsWide() const noexcept;
     int GetButtonsTall() const noexcept;
     int GetBombCount() const noexcept;
-    int GetButtonCount() const noexcept;
+    std::size_t GetButtonCount() const noexcept;
   };
 }  // namespace fsweep
 
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_GAME_FILE_HPP
+#define FSWEEP_GAME_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/GameModel.hpp>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <string_view>
+
+namespace fsweep
+{
+  // A little endian binary save of a GameModel. A 40 byte header holds the magic "FSWP", the
+  // version, the flags, the GameState, the dimensions, the bomb count, the seed and the game time.
+  // It is followed by a bomb plane with 1 bit per Button and a ButtonState plane with 2 bits per
+  // Button, both in row major order starting with the lowest bits of each byte.
+  class GameFile
+  {
+   public:
+    static const std::uint32_t MAGIC;
+    static const std::uint16_t VERSION;
+    static const std::size_t HEADER_SIZE;
+    static const std::uint8_t QUESTIONS_ENABLED_FLAG;
+
+    static void Write(const fsweep::GameModel& game_model, std::ostream& stream);
+    static void Write(const fsweep::GameModel& game_model, std::string_view path);
+    static std::unique_ptr<fsweep::GameModel> Read(std::span<const std::uint8_t> data);
+    static std::unique_ptr<fsweep::GameModel> Read(std::string_view path);
+  };
+}  // namespace fsweep
+
+#endif
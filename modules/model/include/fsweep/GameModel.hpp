@@ -23,12 +23,18 @@
 #ifndef FSWEEP_GAME_MODEL_HPP
 #define FSWEEP_GAME_MODEL_HPP
 
+#include <fsweep/ActionJournal.hpp>
 #include <fsweep/Button.hpp>
+#include <fsweep/GameAction.hpp>
 #include <fsweep/GameConfiguration.hpp>
 #include <fsweep/GameState.hpp>
+#include <fsweep/IndexedSet.hpp>
 #include <fsweep/ButtonPosition.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <random>
+#include <span>
 #include <stack>
 #include <string>
 #include <vector>
@@ -38,55 +44,142 @@ namespace fsweep
   class GameModel
   {
    protected:
-    std::vector<fsweep::Button> buttons =
+    // a Button is only valid for the current game when its epoch matches button_epoch, so a new
+    // game is started by advancing button_epoch instead of resetting every Button
+    mutable std::vector<fsweep::Button> buttons =
         std::vector<fsweep::Button>(fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE *
                                     fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL);
+    mutable std::vector<std::uint8_t> button_epochs =
+        std::vector<std::uint8_t>(fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE *
+                                  fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL);
+    std::uint8_t button_epoch = 0;
     fsweep::GameConfiguration game_configuration = fsweep::GameConfiguration();
     fsweep::GameState game_state = fsweep::GameState::Default;
     bool questions_enabled = false;
+    // with lazy counting the surrounding bombs of a Button are counted when it is first needed
+    bool lazy_counting = false;
     int flag_count = 0;
-    int buttons_left = (fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE *
-                        fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL) -
-                       fsweep::GameConfiguration::BEGINNER_BOMB_COUNT;
+    std::int64_t buttons_left = (fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE *
+                                 fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL) -
+                                fsweep::GameConfiguration::BEGINNER_BOMB_COUNT;
     unsigned long game_time = 0;
-    std::random_device rnd = std::random_device();
-    std::mt19937 rng = std::mt19937(rnd());
+    // a Zobrist hash of what is visible of every Button, kept up to date by every change
+    std::uint64_t board_hash = 0;
+    // counts the games started, since every new board of any size has the same board hash
+    std::uint64_t game_number = 0;
+    // the covered Buttons next to a revealed number and the revealed numbers next to a covered
+    // Button, only kept while frontier tracking is on
+    bool frontier_tracking = false;
+    fsweep::IndexedSet covered_frontier = fsweep::IndexedSet();
+    fsweep::IndexedSet number_frontier = fsweep::IndexedSet();
+    std::uint64_t seed = fsweep::GameModel::getRandomSeed();
+    // the state of a SplitMix64 stream, which is all a copy needs to continue the same stream
+    std::uint64_t rng_state = seed;
+    std::uint64_t placement_rng_state = 0;
+    fsweep::ThreadPool* thread_pool = nullptr;
     std::vector<fsweep::ButtonPosition> flood_fill_stack = std::vector<fsweep::ButtonPosition>();
+    // told about every click that can change a game in progress, before it is applied, and since
+    // undo and redo are not clicks they are refused while a listener is set
+    std::function<void(fsweep::GameAction, int, int)> action_listener =
+        std::function<void(fsweep::GameAction, int, int)>();
+    fsweep::ActionJournal action_journal = fsweep::ActionJournal();
 
    protected:
+    static void checkMemoryEstimate(const fsweep::GameConfiguration& game_configuration,
+                                    bool frontier_tracking);
+    static std::uint64_t getRandomSeed() noexcept;
+    std::uint64_t getRandom() noexcept;
+    fsweep::ThreadPool& getThreadPool();
+    int getStripeRows() const noexcept;
+    void clearButton(std::size_t button_i) noexcept;
+    void invalidateButtons() noexcept;
+    void syncButtons() const noexcept;
+    std::uint64_t computeBoardHash() const noexcept;
+    bool hasBomb(int x, int y) const noexcept;
+    void countButton(int x, int y) const noexcept;
     fsweep::Button& getButton(int x, int y);
+    void changeButton(int x, int y, fsweep::ButtonState button_state);
+    void updateFrontierButton(int x, int y);
+    void updateFrontier(int x, int y);
+    void beginAction(fsweep::GameAction game_action, int x, int y);
     void pressButton(int x, int y);
     void floodFillClick(int x, int y);
+    void floodFillParallel();
     bool choordingPossible(int x, int y);
     void surroundingButtonAction(
         const fsweep::ButtonPosition& center_position,
         std::function<void(const fsweep::Button&, const fsweep::ButtonPosition&)> action);
     void placeBombs(int initial_x, int initial_y);
+    void placeBombsParallel(int initial_x, int initial_y);
     void calculateSurroundingBombs();
+    void calculateSurroundingBombsParallel();
     void tryWin() noexcept;
 
    public:
+    static const std::uint64_t MAX_MEMORY_ESTIMATE;
+    static const std::size_t PARALLEL_BUTTON_COUNT;
+    static const std::size_t PARALLEL_FLOOD_FILL_COUNT;
+
     GameModel() noexcept = default;
+    // a copy, like Clone and Fork, copies every Button, its epoch and both frontier sets, so it
+    // costs O(n) time and memory, as nothing is shared copy-on-write with the original
+    GameModel(const fsweep::GameModel& game_model);
+    GameModel(fsweep::GameModel&& game_model) = default;
     GameModel(fsweep::GameConfiguration game_configuration, bool questions_enabled,
               fsweep::GameState game_state, int game_time, std::string_view button_string);
+    GameModel(fsweep::GameConfiguration game_configuration, bool questions_enabled,
+              fsweep::GameState game_state, unsigned long game_time,
+              std::span<const std::uint8_t> bomb_plane, std::span<const std::uint8_t> state_plane);
 
+    fsweep::GameModel& operator=(const fsweep::GameModel& game_model);
+    fsweep::GameModel& operator=(fsweep::GameModel&& game_model) = default;
+
+    fsweep::GameModel Clone() const;
+    fsweep::GameModel Fork(std::uint64_t fork_i) const;
     void NewGame();
     void NewGame(fsweep::GameConfiguration game_configuration);
     void ClickButton(int x, int y);
     void AltClickButton(int x, int y);
     void AreaClickButton(int x, int y);
+    void SetJournalCapacity(std::size_t action_capacity, std::size_t change_capacity);
+    bool Undo();
+    bool Redo();
+    std::uint64_t GetBoardHash() const noexcept;
+    std::uint64_t GetGameNumber() const noexcept;
+    bool GetCanUndo() const noexcept;
+    bool GetCanRedo() const noexcept;
     void SetQuestionsEnabled(bool questions_enabled);
     bool GetQuestionsEnabled() const noexcept;
+    void SetLazyCounting(bool lazy_counting);
+    bool GetLazyCounting() const noexcept;
+    void SetFrontierTracking(bool frontier_tracking);
+    bool GetFrontierTracking() const noexcept;
+    std::span<const std::uint32_t> GetCoveredFrontier() const noexcept;
+    std::span<const std::uint32_t> GetNumberFrontier() const noexcept;
+    void SetSeed(std::uint64_t seed);
+    std::uint64_t GetSeed() const noexcept;
+    void SetThreadPool(fsweep::ThreadPool& thread_pool) noexcept;
+    void SetActionListener(std::function<void(fsweep::GameAction, int, int)> action_listener);
     int GetFlagCount() const noexcept;
     int GetBombsLeft() const noexcept;
-    int GetButtonsLeft() const noexcept;
+    std::int64_t GetButtonsLeft() const noexcept;
     void UpdateTime(unsigned int game_time);
     fsweep::GameState GetGameState() const noexcept;
     fsweep::GameConfiguration GetGameConfiguration() const noexcept;
     unsigned long GetGameTime() const noexcept;
     unsigned long GetTimerSeconds() const noexcept;
     const fsweep::Button& GetButton(int x, int y) const;
+    std::string ToButtonString() const;
+    std::vector<std::uint8_t> ToBombPlane() const;
+    std::vector<std::uint8_t> ToStatePlane() const;
+    // not a cheap accessor, it first brings every Button up to date for the current game, which
+    // is O(n) and writes to the model, so it must not race with other readers of the same model
     const std::vector<fsweep::Button>& GetButtons() const noexcept;
+
+    static std::uint64_t GetMemoryEstimate(const fsweep::GameConfiguration& game_configuration,
+                                           bool frontier_tracking = false) noexcept;
+    static std::size_t GetBombPlaneSize(std::size_t button_count) noexcept;
+    static std::size_t GetStatePlaneSize(std::size_t button_count) noexcept;
   };
 }  // namespace fsweep
 
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_HINT_HPP
+#define FSWEEP_HINT_HPP
+
+#include <cstdint>
+
+namespace fsweep
+{
+  struct Hint
+  {
+    int x, y;
+    // the chance that the Button hides a bomb, 0 when it is provably safe
+    double risk;
+    // the game and the board the hint was found for, a hint is stale once either changes
+    std::uint64_t game_number;
+    std::uint64_t board_hash;
+    std::uint64_t latency_us;
+
+    constexpr Hint() noexcept
+        : x(0), y(0), risk(1.0), game_number(0), board_hash(0), latency_us(0)
+    {
+    }
+
+    constexpr Hint(const int x, const int y, const double risk, const std::uint64_t game_number,
+                   const std::uint64_t board_hash) noexcept
+        : x(x), y(y), risk(risk), game_number(game_number), board_hash(board_hash), latency_us(0)
+    {
+    }
+
+    constexpr bool GetIsSafe() const noexcept { return this->risk == 0.0; }
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_HINT_ENGINE_HPP
+#define FSWEEP_HINT_ENGINE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/GameState.hpp>
+#include <fsweep/Hint.hpp>
+#include <fsweep/LatencyHistogram.hpp>
+#include <fsweep/RiskLayer.hpp>
+#include <fsweep/RiskSampler.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fsweep
+{
+  // Finds a hint for a game on a background thread. Each request hands the thread a clone of the
+  // GameModel, replacing any request it has not started yet, so the caller never waits for an
+  // analysis. The analysis only looks at the numbers next to covered Buttons, which a GameModel
+  // with frontier tracking keeps up to date after each move. A hint is only given out while the
+  // game number and the board hash still match the board it was found for. With risk tracking
+  // the thread also keeps a RiskLayer of the board and collects the levels it changed until they
+  // are taken. When no Button is known to be safe, or every risk is wanted, the frontier risks
+  // come from a RiskSampler running on the engine's own ThreadPool for a few milliseconds.
+  class HintEngine
+  {
+   private:
+    std::mutex mutex = std::mutex();
+    std::condition_variable request_condition = std::condition_variable();
+    std::unique_ptr<fsweep::GameModel> request_model = std::unique_ptr<fsweep::GameModel>();
+    std::chrono::steady_clock::time_point request_time = std::chrono::steady_clock::time_point();
+    // the last board requested, only used by the requesting thread
+    bool has_requested = false;
+    std::uint64_t requested_game_number = 0;
+    std::uint64_t requested_board_hash = 0;
+    fsweep::GameState requested_game_state = fsweep::GameState::Default;
+    std::optional<fsweep::Hint> hint = std::optional<fsweep::Hint>();
+    fsweep::LatencyHistogram latency_histogram = fsweep::LatencyHistogram();
+    std::function<void()> hint_listener = std::function<void()>();
+    bool risk_tracking = false;
+    // advanced whenever risk tracking changes so the thread starts a new RiskLayer
+    std::uint64_t risk_generation = 0;
+    // the board that the collected changes describe
+    std::uint64_t risk_game_number = 0;
+    std::uint64_t risk_board_hash = 0;
+    std::unordered_map<std::size_t, std::uint8_t> risk_changes =
+        std::unordered_map<std::size_t, std::uint8_t>();
+    // only used by the thread
+    fsweep::RiskLayer risk_layer = fsweep::RiskLayer();
+    std::uint64_t risk_layer_generation = 0;
+    fsweep::ThreadPool thread_pool;
+    fsweep::RiskSampler risk_sampler;
+    bool stopping = false;
+    std::thread thread = std::thread();
+
+    void threadLoop();
+
+   public:
+    HintEngine();
+    HintEngine(const fsweep::HintEngine&) = delete;
+    fsweep::HintEngine& operator=(const fsweep::HintEngine&) = delete;
+    ~HintEngine();
+
+    static std::optional<fsweep::Hint> Analyze(const fsweep::GameModel& game_model,
+                                               fsweep::RiskSampler* risk_sampler = nullptr);
+    static std::vector<float> AnalyzeRisks(const fsweep::GameModel& game_model,
+                                           fsweep::RiskSampler* risk_sampler = nullptr);
+
+    void SetHintListener(std::function<void()> hint_listener);
+    bool Request(const fsweep::GameModel& game_model);
+    std::optional<fsweep::Hint> GetHint(const fsweep::GameModel& game_model);
+    fsweep::LatencyHistogram GetLatencyHistogram();
+    void SetRiskTracking(bool risk_tracking);
+    bool GetRiskTracking();
+    bool TakeRiskChanges(const fsweep::GameModel& game_model,
+                         std::vector<std::pair<std::size_t, std::uint8_t>>& risk_changes);
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_INDEXED_SET_HPP
+#define FSWEEP_INDEXED_SET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace fsweep
+{
+  // A set of indices below a fixed size with constant time insert, erase and lookup. The values
+  // are kept densely packed so they can be iterated in time proportional to the size of the set.
+  // Indices and positions are 32 bits wide, which keeps a set to 4 bytes per index plus 4 bytes
+  // per value.
+  class IndexedSet
+  {
+   private:
+    std::vector<std::uint32_t> values = std::vector<std::uint32_t>();
+    std::vector<std::uint32_t> positions = std::vector<std::uint32_t>();
+
+   public:
+    static const std::uint32_t NO_POSITION;
+
+    IndexedSet() noexcept = default;
+    explicit IndexedSet(std::size_t index_count);
+
+    void Insert(std::size_t index);
+    void Erase(std::size_t index) noexcept;
+    void Clear() noexcept;
+    bool GetContains(std::size_t index) const noexcept;
+    std::size_t GetSize() const noexcept;
+    std::span<const std::uint32_t> GetValues() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
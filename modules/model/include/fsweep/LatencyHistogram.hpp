@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_LATENCY_HISTOGRAM_HPP
+#define FSWEEP_LATENCY_HISTOGRAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fsweep
+{
+  class LatencyHistogram
+  {
+   public:
+    static const int SUB_BUCKET_BITS;
+    static const std::size_t SUB_BUCKET_COUNT;
+    static const std::size_t BUCKET_COUNT;
+
+   private:
+    std::vector<std::uint64_t> counts =
+        std::vector<std::uint64_t>(fsweep::LatencyHistogram::BUCKET_COUNT);
+    std::uint64_t total_count = 0;
+    std::uint64_t min_value = UINT64_MAX;
+    std::uint64_t max_value = 0;
+    long double value_sum = 0.0;
+
+   public:
+    LatencyHistogram() = default;
+
+    static std::size_t GetBucketIndex(std::uint64_t value) noexcept;
+    static std::uint64_t GetBucketLowestValue(std::size_t bucket_i) noexcept;
+    static std::uint64_t GetBucketHighestValue(std::size_t bucket_i) noexcept;
+
+    void Record(std::uint64_t value) noexcept;
+    void Merge(const fsweep::LatencyHistogram& other) noexcept;
+    void Reset() noexcept;
+    std::uint64_t GetCount() const noexcept;
+    std::uint64_t GetMin() const noexcept;
+    std::uint64_t GetMax() const noexcept;
+    double GetMean() const noexcept;
+    std::uint64_t GetValueAtPercentile(double percentile) const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_MAPPED_FILE_HPP
+#define FSWEEP_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace fsweep
+{
+  // a read only view of a whole file mapped into memory
+  class MappedFile
+  {
+   private:
+    const std::uint8_t* data = nullptr;
+    std::size_t size = 0;
+#ifdef _WIN32
+    void* file_handle = nullptr;
+    void* mapping_handle = nullptr;
+#endif
+
+    void close() noexcept;
+
+   public:
+    explicit MappedFile(std::string_view path);
+    MappedFile(const fsweep::MappedFile&) = delete;
+    fsweep::MappedFile& operator=(const fsweep::MappedFile&) = delete;
+    ~MappedFile();
+
+    std::span<const std::uint8_t> GetData() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
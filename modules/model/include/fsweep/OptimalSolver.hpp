@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_OPTIMAL_SOLVER_HPP
+#define FSWEEP_OPTIMAL_SOLVER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fsweep
+{
+  // Finds the highest chance of winning a tiny board and the moves that reach it by trying every
+  // move against every arrangement of bombs. What a player can see decides which arrangements are
+  // still possible, all equally likely, so the result for each visible board is kept in a table
+  // and shared by every order of moves that reaches it, and by its mirror images. The table is
+  // split into shards with their own locks so the first clicks can be solved on every thread of a
+  // ThreadPool at once. A Button that is safe in every arrangement is always clicked first, and a
+  // move is given up once it could not win more arrangements than the best move found so far.
+  class OptimalSolver
+  {
+   private:
+    using StateKey = std::array<std::uint64_t, 4>;
+
+    struct StateKeyHash
+    {
+      std::size_t operator()(const StateKey& state_key) const noexcept;
+    };
+
+    struct StateEntry
+    {
+      std::uint32_t win_count;
+      std::uint32_t arrangement_count;
+      std::uint8_t button_i;
+    };
+
+    struct Shard
+    {
+      std::mutex mutex = std::mutex();
+      std::unordered_map<StateKey, StateEntry, StateKeyHash> state_entries =
+          std::unordered_map<StateKey, StateEntry, StateKeyHash>();
+    };
+
+    struct Arrangement
+    {
+      std::uint64_t bomb_mask;
+      std::uint64_t zero_mask;
+    };
+
+    fsweep::GameConfiguration game_configuration;
+    std::size_t button_count = 0;
+    std::size_t bomb_count = 0;
+    std::uint64_t all_mask = 0;
+    std::vector<std::uint64_t> neighbour_masks = std::vector<std::uint64_t>();
+    // each symmetry of the board maps every Button to another, and back in inverse_maps
+    std::size_t symmetry_count = 0;
+    std::vector<std::uint8_t> symmetry_maps = std::vector<std::uint8_t>();
+    std::vector<std::uint8_t> inverse_maps = std::vector<std::uint8_t>();
+    std::vector<Shard> shards;
+    std::uint64_t first_arrangement_count = 0;
+    std::vector<std::uint64_t> first_win_counts = std::vector<std::uint64_t>();
+    bool solved = false;
+
+    fsweep::OptimalSolver::Arrangement getArrangement(std::uint64_t bomb_mask) const noexcept;
+    fsweep::OptimalSolver::StateKey getStateKey(std::uint64_t revealed_mask,
+                                                std::uint64_t bomb_mask) const noexcept;
+    std::pair<fsweep::OptimalSolver::StateKey, std::size_t> getCanonicalKey(
+        const StateKey& state_key) const noexcept;
+    std::optional<fsweep::OptimalSolver::StateEntry> findState(const StateKey& state_key);
+    void storeState(const StateKey& state_key, StateEntry state_entry);
+    fsweep::OptimalSolver::StateEntry solveState(const StateKey& state_key,
+                                                 std::uint64_t revealed_mask,
+                                                 const std::vector<Arrangement>& arrangements);
+    std::uint64_t solveMove(std::uint64_t revealed_mask,
+                            const std::vector<Arrangement>& arrangements, std::size_t button_i,
+                            std::uint64_t best_win_count);
+    fsweep::OptimalSolver::StateEntry getStateEntry(const fsweep::GameModel& game_model);
+
+   public:
+    static const std::size_t MAX_BUTTON_COUNT;
+    static const std::uint64_t MAX_ARRANGEMENT_COUNT;
+    static const std::size_t SHARD_COUNT;
+
+    explicit OptimalSolver(const fsweep::GameConfiguration& game_configuration);
+    OptimalSolver(const fsweep::OptimalSolver&) = delete;
+    fsweep::OptimalSolver& operator=(const fsweep::OptimalSolver&) = delete;
+
+    void Solve(fsweep::ThreadPool& thread_pool);
+    double GetWinProbability() const noexcept;
+    double GetFirstClickWinProbability(int x, int y) const noexcept;
+    fsweep::ButtonPosition GetFirstClick() const noexcept;
+    std::optional<fsweep::ButtonPosition> GetMove(const fsweep::GameModel& game_model);
+    double GetStateWinProbability(const fsweep::GameModel& game_model);
+    std::size_t GetStateCount();
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_PRESET_BOARD_HPP
+#define FSWEEP_PRESET_BOARD_HPP
+
+#include <array>
+#include <cstdint>
+#include <fsweep/Button.hpp>
+#include <fsweep/GameConfiguration.hpp>
+
+namespace fsweep
+{
+  template <int BUTTONS_WIDE, int BUTTONS_TALL, int BOMB_COUNT>
+  class PresetBoard
+  {
+    static_assert(BUTTONS_WIDE > 0 && BUTTONS_TALL > 0);
+    static_assert(BOMB_COUNT >= 0 && BOMB_COUNT <= BUTTONS_WIDE * BUTTONS_TALL);
+
+   public:
+    static constexpr int BUTTON_COUNT = BUTTONS_WIDE * BUTTONS_TALL;
+    // the bomb plane has a border of empty cells so no neighbour needs a bounds check
+    static constexpr int PLANE_WIDE = BUTTONS_WIDE + 2;
+    static constexpr int PLANE_TALL = BUTTONS_TALL + 2;
+    static constexpr std::array<int, 8> NEIGHBOUR_OFFSETS = {
+        -PLANE_WIDE - 1, -PLANE_WIDE, -PLANE_WIDE + 1, -1, 1,
+        PLANE_WIDE - 1,  PLANE_WIDE,  PLANE_WIDE + 1};
+
+    static void CalculateSurroundingBombs(fsweep::Button* buttons) noexcept
+    {
+      std::array<std::uint8_t, PLANE_WIDE * PLANE_TALL> bomb_plane{};
+      for (int y = 0; y < BUTTONS_TALL; y++)
+      {
+        for (int x = 0; x < BUTTONS_WIDE; x++)
+        {
+          bomb_plane[((y + 1) * PLANE_WIDE) + x + 1] =
+              buttons[(y * BUTTONS_WIDE) + x].GetHasBomb() ? 1 : 0;
+        }
+      }
+      for (int y = 0; y < BUTTONS_TALL; y++)
+      {
+        for (int x = 0; x < BUTTONS_WIDE; x++)
+        {
+          const int plane_i = ((y + 1) * PLANE_WIDE) + x + 1;
+          int surrounding_bombs = 0;
+          for (const auto offset : NEIGHBOUR_OFFSETS)
+          {
+            surrounding_bombs += bomb_plane[plane_i + offset];
+          }
+          buttons[(y * BUTTONS_WIDE) + x].SetSurroundingBombs(surrounding_bombs);
+        }
+      }
+    }
+  };
+
+  using BeginnerBoard = fsweep::PresetBoard<fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE,
+                                            fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL,
+                                            fsweep::GameConfiguration::BEGINNER_BOMB_COUNT>;
+  using IntermediateBoard =
+      fsweep::PresetBoard<fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_WIDE,
+                          fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_TALL,
+                          fsweep::GameConfiguration::INTERMEDIATE_BOMB_COUNT>;
+  using ExpertBoard = fsweep::PresetBoard<fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE,
+                                          fsweep::GameConfiguration::EXPERT_BUTTONS_TALL,
+                                          fsweep::GameConfiguration::EXPERT_BOMB_COUNT>;
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_REPLAY_EVENT_HPP
+#define FSWEEP_REPLAY_EVENT_HPP
+
+#include <fsweep/GameAction.hpp>
+
+namespace fsweep
+{
+  struct ReplayEvent
+  {
+    unsigned long game_time;
+    fsweep::GameAction game_action;
+    int x, y;
+
+    constexpr ReplayEvent() noexcept
+        : game_time(0), game_action(fsweep::GameAction::Click), x(0), y(0)
+    {
+    }
+
+    constexpr ReplayEvent(const unsigned long game_time, const fsweep::GameAction game_action,
+                          const int x, const int y) noexcept
+        : game_time(game_time), game_action(game_action), x(x), y(y)
+    {
+    }
+
+    constexpr bool operator==(const fsweep::ReplayEvent&) const noexcept = default;
+  };
+}  // namespace fsweep
+
+#endif
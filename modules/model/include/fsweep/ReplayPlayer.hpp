@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_REPLAY_PLAYER_HPP
+#define FSWEEP_REPLAY_PLAYER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/GameState.hpp>
+#include <fsweep/ReplayEvent.hpp>
+#include <fsweep/ReplayReader.hpp>
+#include <memory>
+#include <vector>
+
+namespace fsweep
+{
+  // Plays a replay back to any event. The ButtonState plane of the game is kept every
+  // checkpoint_interval events and the bombs are kept once, since they never change after the
+  // first click. Seeking restores the checkpoint before the event and plays the rest of the
+  // events, unless the event is ahead of the current one and no checkpoint lies between them.
+  class ReplayPlayer
+  {
+   private:
+    struct Checkpoint
+    {
+      fsweep::GameState game_state;
+      unsigned long game_time;
+      std::vector<std::uint8_t> state_plane;
+    };
+
+    fsweep::GameConfiguration game_configuration = fsweep::GameConfiguration();
+    bool questions_enabled = false;
+    std::uint64_t seed = 0;
+    std::size_t checkpoint_interval = 0;
+    std::vector<fsweep::ReplayEvent> replay_events = std::vector<fsweep::ReplayEvent>();
+    std::vector<fsweep::ReplayPlayer::Checkpoint> checkpoints =
+        std::vector<fsweep::ReplayPlayer::Checkpoint>();
+    std::vector<std::uint8_t> bomb_plane = std::vector<std::uint8_t>();
+    std::unique_ptr<fsweep::GameModel> game_model = nullptr;
+    std::size_t event_i = 0;
+
+    void restoreCheckpoint(std::size_t checkpoint_i);
+
+   public:
+    static const std::size_t DEFAULT_CHECKPOINT_INTERVAL;
+
+    explicit ReplayPlayer(
+        fsweep::ReplayReader& replay_reader,
+        std::size_t checkpoint_interval = fsweep::ReplayPlayer::DEFAULT_CHECKPOINT_INTERVAL);
+
+    void Seek(std::size_t event_i);
+    std::size_t GetEventIndex() const noexcept;
+    std::size_t GetEventCount() const noexcept;
+    std::size_t GetCheckpointCount() const noexcept;
+    const fsweep::ReplayEvent& GetEvent(std::size_t event_i) const;
+    const fsweep::GameModel& GetGameModel() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
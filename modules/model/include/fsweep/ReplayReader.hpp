@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_REPLAY_READER_HPP
+#define FSWEEP_REPLAY_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/ReplayEvent.hpp>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <vector>
+
+namespace fsweep
+{
+  // streams the events of a replay written by a ReplayWriter one block at a time
+  class ReplayReader
+  {
+   private:
+    std::reference_wrapper<std::istream> stream;
+    std::vector<std::uint8_t> block = std::vector<std::uint8_t>();
+    std::size_t block_i = 0;
+    fsweep::GameConfiguration game_configuration = fsweep::GameConfiguration();
+    bool questions_enabled = false;
+    std::uint64_t seed = 0;
+    std::uint64_t last_deciseconds = 0;
+    int last_x = 0;
+    int last_y = 0;
+
+    bool getByte(std::uint8_t& byte);
+    std::uint8_t getEventByte();
+    std::uint64_t getVarint(std::uint8_t byte);
+
+   public:
+    explicit ReplayReader(std::istream& stream);
+
+    bool Read(fsweep::ReplayEvent& replay_event);
+    fsweep::GameConfiguration GetGameConfiguration() const noexcept;
+    bool GetQuestionsEnabled() const noexcept;
+    std::uint64_t GetSeed() const noexcept;
+    std::unique_ptr<fsweep::GameModel> CreateGameModel() const;
+
+    static void Play(const fsweep::ReplayEvent& replay_event, fsweep::GameModel& game_model);
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_REPLAY_WRITER_HPP
+#define FSWEEP_REPLAY_WRITER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/ReplayEvent.hpp>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace fsweep
+{
+  // Records a game as a replay. A 28 byte little endian header holds the magic "FSRP", the
+  // version, the flags, the dimensions, the bomb count and the seed the GameModel was given before
+  // its first click. Each event follows as a varint key holding the deciseconds since the last
+  // event, the GameAction and whether the position moved by less than 8 Buttons, so most events
+  // take 2 bytes. A near position is one byte of two 4 bit offsets, a far one is two zigzag
+  // varints. Events are collected in blocks of BLOCK_SIZE bytes that a background thread writes.
+  class ReplayWriter
+  {
+   private:
+    std::reference_wrapper<std::ostream> stream;
+    std::vector<std::uint8_t> block = std::vector<std::uint8_t>();
+    std::deque<std::vector<std::uint8_t>> full_blocks = std::deque<std::vector<std::uint8_t>>();
+    std::vector<std::vector<std::uint8_t>> free_blocks =
+        std::vector<std::vector<std::uint8_t>>();
+    std::mutex mutex = std::mutex();
+    std::condition_variable block_condition = std::condition_variable();
+    std::condition_variable done_condition = std::condition_variable();
+    bool writing = false;
+    bool stopping = false;
+    bool failed = false;
+    std::uint64_t last_deciseconds = 0;
+    int last_x = 0;
+    int last_y = 0;
+    std::size_t event_count = 0;
+    std::thread thread = std::thread();
+
+    void threadLoop();
+    void putByte(std::uint8_t byte);
+    void putVarint(std::uint64_t value);
+    void queueBlock();
+
+   public:
+    static const std::uint32_t MAGIC;
+    static const std::uint16_t VERSION;
+    static const std::size_t HEADER_SIZE;
+    static const std::size_t BLOCK_SIZE;
+    static const std::uint8_t QUESTIONS_ENABLED_FLAG;
+    static const unsigned long MILLISECONDS_PER_DECISECOND;
+    // positions closer than this to the last event are stored as a single byte
+    static const int NEAR_OFFSET;
+
+    ReplayWriter(std::ostream& stream, const fsweep::GameConfiguration& game_configuration,
+                 bool questions_enabled, std::uint64_t seed);
+    ReplayWriter(const fsweep::ReplayWriter&) = delete;
+    fsweep::ReplayWriter& operator=(const fsweep::ReplayWriter&) = delete;
+    ~ReplayWriter();
+
+    void Write(const fsweep::ReplayEvent& replay_event);
+    void Flush();
+    std::size_t GetEventCount() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_RISK_LAYER_HPP
+#define FSWEEP_RISK_LAYER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace fsweep
+{
+  // The bomb risk shown for each Button, quantized to LEVEL_COUNT levels. An update only changes
+  // the level of a Button when its risk moved by at least RISK_THRESHOLD since its level was set,
+  // or when it became certain, so small swings do not cause redraws.
+  class RiskLayer
+  {
+   private:
+    std::vector<float> risks = std::vector<float>();
+    std::vector<std::uint8_t> levels = std::vector<std::uint8_t>();
+
+   public:
+    static const std::uint8_t LEVEL_COUNT;
+    static const std::uint8_t NO_LEVEL;
+    static const float NO_RISK;
+    static const float RISK_THRESHOLD;
+
+    RiskLayer() noexcept = default;
+
+    static std::uint8_t GetRiskLevel(float risk) noexcept;
+
+    bool Update(std::span<const float> risks, std::vector<std::size_t>& changed_is);
+    void Clear() noexcept;
+    std::uint8_t GetLevel(std::size_t button_i) const noexcept;
+    std::size_t GetButtonCount() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef FSWEEP_RISK_SAMPLER_HPP
+#define FSWEEP_RISK_SAMPLER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/ThreadPool.hpp>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace fsweep
+{
+  // Estimates the bomb risk of the Buttons in a set of constraints by sampling arrangements of
+  // bombs. Every thread of the ThreadPool runs its own Metropolis chain on its own SplitMix64
+  // stream until the time budget runs out. A chain flips one Button or a pair of Buttons at a time
+  // and targets C(U, M - m) * exp(-PENALTY * v), where U is the number of Buttons outside the
+  // constraints, M the bombs left, m the bombs placed and v how far the constraints are missed,
+  // so only the arrangements that miss nothing are counted. The samples of each chain are grouped
+  // in batches whose spread gives a 95% margin for every risk.
+  class RiskSampler
+  {
+   private:
+    std::reference_wrapper<fsweep::ThreadPool> thread_pool;
+    std::chrono::microseconds time_budget = fsweep::RiskSampler::DEFAULT_TIME_BUDGET;
+    std::vector<std::size_t> constraint_button_is = std::vector<std::size_t>();
+    std::vector<std::size_t> constraint_starts = std::vector<std::size_t>();
+    std::vector<int> bomb_counts = std::vector<int>();
+    std::vector<std::size_t> button_is = std::vector<std::size_t>();
+    std::vector<float> risks = std::vector<float>();
+    std::vector<float> margins = std::vector<float>();
+    float interior_risk = 0.0f;
+    std::uint64_t sample_count = 0;
+
+   public:
+    static const std::chrono::microseconds DEFAULT_TIME_BUDGET;
+    static const double PENALTY;
+    static const std::size_t BATCH_SIZE;
+    static const std::size_t MAX_BATCH_COUNT;
+
+    explicit RiskSampler(fsweep::ThreadPool& thread_pool) noexcept;
+
+    void SetTimeBudget(std::chrono::microseconds time_budget) noexcept;
+    std::chrono::microseconds GetTimeBudget() const noexcept;
+    void AddConstraint(std::span<const std::size_t> button_is, int bomb_count);
+    void Clear() noexcept;
+    void Sample(std::int64_t interior_count, std::int64_t bombs_left, std::uint64_t seed);
+    std::span<const std::size_t> GetButtons() const noexcept;
+    std::span<const float> GetRisks() const noexcept;
+    std::span<const float> GetMargins() const noexcept;
+    float GetInteriorRisk() const noexcept;
+    std::uint64_t GetSampleCount() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_THREAD_POOL_HPP
+#define FSWEEP_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace fsweep
+{
+  class ThreadPool
+  {
+   private:
+    std::vector<std::thread> threads = std::vector<std::thread>();
+    std::mutex parallel_for_mutex = std::mutex();
+    std::mutex mutex = std::mutex();
+    std::condition_variable task_condition = std::condition_variable();
+    std::condition_variable done_condition = std::condition_variable();
+    const std::function<void(std::size_t)>* task = nullptr;
+    std::size_t task_count = 0;
+    std::atomic<std::size_t> next_task_i = 0;
+    std::atomic<std::size_t> tasks_done = 0;
+    std::size_t generation = 0;
+    std::size_t active_threads = 0;
+    bool stopping = false;
+
+    void threadLoop();
+    void runTasks();
+
+   public:
+    explicit ThreadPool(unsigned int thread_count);
+    ThreadPool(const fsweep::ThreadPool&) = delete;
+    fsweep::ThreadPool& operator=(const fsweep::ThreadPool&) = delete;
+    ~ThreadPool();
+
+    static fsweep::ThreadPool& GetInstance();
+
+    void ParallelFor(std::size_t task_count, const std::function<void(std::size_t)>& task);
+    unsigned int GetThreadCount() const noexcept;
+  };
+}  // namespace fsweep
+
+#endif
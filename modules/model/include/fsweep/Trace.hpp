@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef FSWEEP_TRACE_HPP
+#define FSWEEP_TRACE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace fsweep
+{
+  enum class TraceEventType
+  {
+    Zone,
+    Counter
+  };
+
+  struct TraceEvent
+  {
+    fsweep::TraceEventType type = fsweep::TraceEventType::Zone;
+    const char* name = "";
+    std::size_t thread_id = 0;
+    double start_us = 0.0;
+    double duration_us = 0.0;
+    long long value = 0;
+  };
+
+  class TraceRecorder
+  {
+   private:
+    std::chrono::steady_clock::time_point origin = std::chrono::steady_clock::now();
+    std::vector<fsweep::TraceEvent> events = std::vector<fsweep::TraceEvent>();
+    std::mutex events_mutex = std::mutex();
+
+   public:
+    TraceRecorder() noexcept = default;
+
+    static fsweep::TraceRecorder& GetInstance();
+
+    double GetTimestamp() const noexcept;
+    void RecordZone(const char* name, double start_us, double end_us);
+    void RecordCounter(const char* name, long long value);
+    void Clear();
+    std::vector<fsweep::TraceEvent> GetEvents();
+    void WriteChromeTrace(std::ostream& stream);
+    bool WriteChromeTrace(std::string_view path);
+  };
+
+  class TraceZone
+  {
+   private:
+    const char* name;
+    double start_us;
+
+   public:
+    TraceZone(const char* name) noexcept;
+    TraceZone(const fsweep::TraceZone&) = delete;
+    TraceZone& operator=(const fsweep::TraceZone&) = delete;
+    ~TraceZone();
+  };
+}  // namespace fsweep
+
+#ifdef FSWEEP_ENABLE_TRACING
+#  define FSWEEP_TRACE_CONCAT_IMPL(a, b) a##b
+#  define FSWEEP_TRACE_CONCAT(a, b) FSWEEP_TRACE_CONCAT_IMPL(a, b)
+#  define FSWEEP_TRACE_ZONE(name) \
+    const fsweep::TraceZone FSWEEP_TRACE_CONCAT(fsweep_trace_zone_, __LINE__)(name)
+#  define FSWEEP_TRACE_COUNTER(name, value) \
+    fsweep::TraceRecorder::GetInstance().RecordCounter(name, static_cast<long long>(value))
+#else
+#  define FSWEEP_TRACE_ZONE(name)
+#  define FSWEEP_TRACE_COUNTER(name, value)
+#endif
+
+#endif
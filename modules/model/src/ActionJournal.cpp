@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fsweep/ActionJournal.hpp>
+#include <stdexcept>
+
+// a change holds the index of its Button above the bits of the ButtonState before the change
+const int CHANGE_BUTTON_INDEX_SHIFT = 2;
+const std::uint64_t CHANGE_BUTTON_STATE_MASK = 0b11;
+
+namespace
+{
+  std::size_t getRingIndex(std::size_t first_i, std::size_t offset, std::size_t size) noexcept
+  {
+    const auto ring_i = first_i + offset;
+    return ring_i < size ? ring_i : ring_i - size;
+  }
+}  // namespace
+
+fsweep::ActionJournal::ActionJournal(std::size_t action_capacity, std::size_t change_capacity)
+    : actions(action_capacity), changes(change_capacity)
+{
+  if ((action_capacity == 0) != (change_capacity == 0))
+  {
+    throw std::runtime_error("invalid action journal capacity");
+  }
+}
+
+fsweep::ActionJournal::Action& fsweep::ActionJournal::getLastAction() noexcept
+{
+  return this->actions[getRingIndex(this->first_action_i, this->action_count - 1,
+                                    this->actions.size())];
+}
+
+void fsweep::ActionJournal::dropFirstAction() noexcept
+{
+  const auto& first_action = this->actions[this->first_action_i];
+  this->first_change_i =
+      getRingIndex(this->first_change_i, first_action.change_count, this->changes.size());
+  this->change_count -= first_action.change_count;
+  this->first_action_i = getRingIndex(this->first_action_i, 1, this->actions.size());
+  this->action_count--;
+}
+
+void fsweep::ActionJournal::pushPendingAction() noexcept
+{
+  this->pending = false;
+  // a new action makes the undone actions unreachable, a redone one is the next undone action
+  if (this->redoing)
+  {
+    this->redo_count--;
+    this->redoing = false;
+  }
+  else
+  {
+    this->redo_count = 0;
+  }
+  if (this->action_count == this->actions.size())
+  {
+    this->dropFirstAction();
+  }
+  this->action_count++;
+  this->getLastAction() = this->pending_action;
+}
+
+void fsweep::ActionJournal::BeginAction(const fsweep::ActionJournal::Action& action) noexcept
+{
+  if (this->actions.empty()) return;
+  this->pending_action = action;
+  this->pending_action.change_count = 0;
+  this->pending = true;
+  this->recording = true;
+}
+
+void fsweep::ActionJournal::AddChange(std::size_t button_i,
+                                      fsweep::ButtonState button_state) noexcept
+{
+  if (!this->recording) return;
+  if (this->pending) this->pushPendingAction();
+  while (this->change_count == this->changes.size())
+  {
+    if (this->action_count == 1)
+    {
+      this->overflowed = true;
+      this->recording = false;
+      return;
+    }
+    this->dropFirstAction();
+  }
+  this->changes[getRingIndex(this->first_change_i, this->change_count, this->changes.size())] =
+      (static_cast<std::uint64_t>(button_i) << CHANGE_BUTTON_INDEX_SHIFT) |
+      static_cast<std::uint64_t>(button_state);
+  this->change_count++;
+  this->getLastAction().change_count++;
+}
+
+void fsweep::ActionJournal::EndAction() noexcept
+{
+  // an action that changed no Button, like a click on a revealed one, was never pushed
+  this->pending = false;
+  this->redoing = false;
+  this->recording = false;
+  if (this->overflowed)
+  {
+    this->overflowed = false;
+    this->Clear();
+  }
+}
+
+void fsweep::ActionJournal::BeginRedo() noexcept { this->redoing = true; }
+
+bool fsweep::ActionJournal::PopChange(std::size_t& button_i,
+                                      fsweep::ButtonState& button_state) noexcept
+{
+  auto& last_action = this->getLastAction();
+  if (last_action.change_count == 0) return false;
+  const auto change =
+      this->changes[getRingIndex(this->first_change_i, this->change_count - 1,
+                                 this->changes.size())];
+  button_i = static_cast<std::size_t>(change >> CHANGE_BUTTON_INDEX_SHIFT);
+  button_state = static_cast<fsweep::ButtonState>(change & CHANGE_BUTTON_STATE_MASK);
+  this->change_count--;
+  last_action.change_count--;
+  return true;
+}
+
+void fsweep::ActionJournal::PopAction() noexcept
+{
+  this->action_count--;
+  this->redo_count++;
+}
+
+void fsweep::ActionJournal::Clear() noexcept
+{
+  this->first_action_i = 0;
+  this->action_count = 0;
+  this->redo_count = 0;
+  this->first_change_i = 0;
+  this->change_count = 0;
+  this->pending = false;
+  this->recording = false;
+  this->redoing = false;
+}
+
+bool fsweep::ActionJournal::GetIsRecording() const noexcept { return this->recording; }
+
+bool fsweep::ActionJournal::GetCanUndo() const noexcept { return this->action_count > 0; }
+
+bool fsweep::ActionJournal::GetCanRedo() const noexcept { return this->redo_count > 0; }
+
+const fsweep::ActionJournal::Action& fsweep::ActionJournal::GetUndoAction() const noexcept
+{
+  return this->actions[getRingIndex(this->first_action_i, this->action_count - 1,
+                                    this->actions.size())];
+}
+
+const fsweep::ActionJournal::Action& fsweep::ActionJournal::GetRedoAction() const noexcept
+{
+  return this->actions[getRingIndex(this->first_action_i, this->action_count,
+                                    this->actions.size())];
+}
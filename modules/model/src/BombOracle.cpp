@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *model
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fsweep/BombOracle.hpp>
+#include <fsweep/CounterRng.hpp>
+#include <limits>
+#include <vector>
+
+// the rows of a board are split into stripes of about this many Buttons for a ThreadPool
+const int STRIPE_BUTTON_COUNT = 1 << 16;
+
+fsweep::BombOracle::BombOracle(fsweep::GameConfiguration game_configuration, std::uint64_t seed)
+    : fsweep::BombOracle(game_configuration, seed, -1, -1)
+{
+}
+
+fsweep::BombOracle::BombOracle(fsweep::GameConfiguration game_configuration, std::uint64_t seed,
+                               int initial_x, int initial_y)
+    : game_configuration(game_configuration)
+    , seed(seed)
+    , initial_position(initial_x, initial_y)
+{
+  fsweep::ThreadPool thread_pool(1);
+  this->findMaxBombHash(thread_pool);
+}
+
+fsweep::BombOracle::BombOracle(fsweep::GameConfiguration game_configuration, std::uint64_t seed,
+                               int initial_x, int initial_y, fsweep::ThreadPool& thread_pool)
+    : game_configuration(game_configuration)
+    , seed(seed)
+    , initial_position(initial_x, initial_y)
+{
+  this->findMaxBombHash(thread_pool);
+}
+
+std::uint64_t fsweep::BombOracle::getFractionHash(double fraction) noexcept
+{
+  if (fraction <= 0) return 0;
+  const auto hash = std::ldexp(fraction, 64);
+  if (hash >= std::ldexp(1.0, 64)) return std::numeric_limits<std::uint64_t>::max();
+  return static_cast<std::uint64_t>(hash);
+}
+
+void fsweep::BombOracle::findMaxBombHash(fsweep::ThreadPool& thread_pool)
+{
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  const bool has_initial_position = this->initial_position.x >= 0 &&
+                                    this->initial_position.x < buttons_wide &&
+                                    this->initial_position.y >= 0 &&
+                                    this->initial_position.y < buttons_tall;
+  const std::uint64_t candidate_count =
+      this->game_configuration.GetButtonCount() - (has_initial_position ? 1 : 0);
+  this->bomb_count = std::min<std::uint64_t>(
+      static_cast<std::uint64_t>(this->game_configuration.GetBombCount()), candidate_count);
+  if (this->bomb_count == 0) return;
+
+  // the bombs are the bomb_count smallest hashes. The hashes are uniform, so the largest bomb hash
+  // is near bomb_count / candidate_count of the hash range. Only the hashes in a band around that
+  // guess are kept, and the band is widened in the unlikely case it misses.
+  const auto bomb_fraction = static_cast<double>(this->bomb_count) / candidate_count;
+  auto band_margin =
+      (8 * std::sqrt(candidate_count * bomb_fraction * (1 - bomb_fraction))) + 64;
+  const auto stripe_rows = std::max(STRIPE_BUTTON_COUNT / buttons_wide, 1);
+  const auto stripe_count =
+      static_cast<std::size_t>((buttons_tall + stripe_rows - 1) / stripe_rows);
+  std::vector<std::uint64_t> stripe_below_counts(stripe_count);
+  std::vector<std::vector<std::uint64_t>> stripe_band_hashes(stripe_count);
+  std::vector<std::uint64_t> band_hashes;
+  while (true)
+  {
+    const auto low_hash = fsweep::BombOracle::getFractionHash(
+        (static_cast<double>(this->bomb_count) - band_margin) / candidate_count);
+    const auto high_hash = fsweep::BombOracle::getFractionHash(
+        (static_cast<double>(this->bomb_count) + band_margin) / candidate_count);
+    thread_pool.ParallelFor(
+        stripe_count,
+        [&](std::size_t stripe_i)
+        {
+          auto& below_count = stripe_below_counts[stripe_i];
+          auto& stripe_hashes = stripe_band_hashes[stripe_i];
+          below_count = 0;
+          stripe_hashes.clear();
+          const auto first_y = static_cast<int>(stripe_i) * stripe_rows;
+          const auto last_y = std::min(first_y + stripe_rows, buttons_tall);
+          for (int y = first_y; y < last_y; y++)
+          {
+            for (int x = 0; x < buttons_wide; x++)
+            {
+              if (x == this->initial_position.x && y == this->initial_position.y) continue;
+              const auto hash = fsweep::BombOracle::GetHash(this->seed, x, y);
+              if (hash < low_hash)
+              {
+                below_count++;
+              }
+              else if (hash <= high_hash)
+              {
+                stripe_hashes.push_back(hash);
+              }
+            }
+          }
+        });
+    std::uint64_t below_count = 0;
+    band_hashes.clear();
+    for (std::size_t stripe_i = 0; stripe_i < stripe_count; stripe_i++)
+    {
+      below_count += stripe_below_counts[stripe_i];
+      band_hashes.insert(band_hashes.end(), stripe_band_hashes[stripe_i].begin(),
+                         stripe_band_hashes[stripe_i].end());
+    }
+    if (below_count < this->bomb_count && this->bomb_count <= below_count + band_hashes.size())
+    {
+      const auto max_bomb_hash_it = band_hashes.begin() + (this->bomb_count - below_count - 1);
+      std::nth_element(band_hashes.begin(), max_bomb_hash_it, band_hashes.end());
+      this->max_bomb_hash = *max_bomb_hash_it;
+      return;
+    }
+    band_margin *= 4;
+  }
+}
+
+std::uint64_t fsweep::BombOracle::GetHash(std::uint64_t seed, std::int64_t x,
+                                          std::int64_t y) noexcept
+{
+  return fsweep::CounterRng::Get(seed, static_cast<std::uint64_t>(x),
+                                 static_cast<std::uint64_t>(y));
+}
+
+std::uint64_t fsweep::BombOracle::GetBombThreshold(double bomb_density) noexcept
+{
+  return fsweep::BombOracle::getFractionHash(bomb_density);
+}
+
+bool fsweep::BombOracle::HasBomb(std::uint64_t seed, std::int64_t x, std::int64_t y,
+                                 std::uint64_t bomb_threshold) noexcept
+{
+  return fsweep::BombOracle::GetHash(seed, x, y) < bomb_threshold;
+}
+
+bool fsweep::BombOracle::HasBomb(int x, int y) const noexcept
+{
+  if (this->bomb_count == 0) return false;
+  if (x == this->initial_position.x && y == this->initial_position.y) return false;
+  return fsweep::BombOracle::GetHash(this->seed, x, y) <= this->max_bomb_hash;
+}
+
+int fsweep::BombOracle::GetSurroundingBombs(int x, int y) const noexcept
+{
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  int surrounding_bombs = 0;
+  for (int neighbour_y = std::max(y - 1, 0); neighbour_y <= std::min(y + 1, buttons_tall - 1);
+       neighbour_y++)
+  {
+    for (int neighbour_x = std::max(x - 1, 0); neighbour_x <= std::min(x + 1, buttons_wide - 1);
+         neighbour_x++)
+    {
+      if ((neighbour_x != x || neighbour_y != y) && this->HasBomb(neighbour_x, neighbour_y))
+      {
+        surrounding_bombs++;
+      }
+    }
+  }
+  return surrounding_bombs;
+}
+
+fsweep::Button fsweep::BombOracle::GetButton(int x, int y) const noexcept
+{
+  fsweep::Button button;
+  button.SetHasBomb(this->HasBomb(x, y));
+  button.SetSurroundingBombs(this->GetSurroundingBombs(x, y));
+  return button;
+}
+
+std::uint64_t fsweep::BombOracle::GetBombCount() const noexcept { return this->bomb_count; }
+
+std::uint64_t fsweep::BombOracle::GetSeed() const noexcept { return this->seed; }
+
+fsweep::GameConfiguration fsweep::BombOracle::GetGameConfiguration() const noexcept
+{
+  return this->game_configuration;
+}
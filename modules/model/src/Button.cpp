@@ -20,104 +20,202 @@
  *
  */
 
+#include <algorithm>
+#include <array>
 #include <fsweep/Button.hpp>
 #include <fsweep/ButtonState.hpp>
 
-fsweep::Button::Button(char c) noexcept
+static_assert(sizeof(fsweep::Button) == 1);
+
+const std::uint8_t BUTTON_STATE_MASK = 0b00000011;
+const std::uint8_t HAS_BOMB_MASK = 0b00000100;
+const std::uint8_t SURROUNDING_BOMBS_MASK = 0b01111000;
+const int SURROUNDING_BOMBS_SHIFT = 3;
+const std::uint8_t IS_COUNTED_MASK = 0b10000000;
+
+namespace
 {
-  switch (c)
+  constexpr std::uint8_t getCharBits(fsweep::ButtonState button_state, bool has_bomb)
   {
-  case 'd':
-    this->button_state = fsweep::ButtonState::Down;
-    break;
-  case 'b':
-    this->has_bomb = true;
-    break;
-  case 'x':
-    this->button_state = fsweep::ButtonState::Down;
-    this->has_bomb = true;
-    break;
-  case 'f':
-    this->button_state = fsweep::ButtonState::Flagged;
-    break;
-  case 'c':
-    this->button_state = fsweep::ButtonState::Flagged;
-    this->has_bomb = true;
-    break;
-  case 'q':
-    this->button_state = fsweep::ButtonState::Questioned;
-    break;
-  case 'r':
-    this->button_state = fsweep::ButtonState::Questioned;
-    this->has_bomb = true;
-    break;
+    return static_cast<std::uint8_t>(button_state) | (has_bomb ? HAS_BOMB_MASK : 0);
   }
+}  // namespace
+
+// the bits of a Button for every char of a button string, any other char is a plain Button
+constexpr std::array<std::uint8_t, 256> CHAR_BITS = []()
+{
+  std::array<std::uint8_t, 256> char_bits{};
+  char_bits['b'] = getCharBits(fsweep::ButtonState::None, true);
+  char_bits['d'] = getCharBits(fsweep::ButtonState::Down, false);
+  char_bits['x'] = getCharBits(fsweep::ButtonState::Down, true);
+  char_bits['f'] = getCharBits(fsweep::ButtonState::Flagged, false);
+  char_bits['c'] = getCharBits(fsweep::ButtonState::Flagged, true);
+  char_bits['q'] = getCharBits(fsweep::ButtonState::Questioned, false);
+  char_bits['r'] = getCharBits(fsweep::ButtonState::Questioned, true);
+  return char_bits;
+}();
+
+// the char of a Button for its ButtonState and bomb bits
+constexpr std::array<char, 8> BITS_CHARS = []()
+{
+  std::array<char, 8> bits_chars{};
+  for (std::size_t c = 0; c < CHAR_BITS.size(); c++)
+  {
+    if (CHAR_BITS[c] != 0) bits_chars[CHAR_BITS[c]] = static_cast<char>(c);
+  }
+  bits_chars[0] = '.';
+  return bits_chars;
+}();
+
+fsweep::Button::Button(char c) noexcept : bits(CHAR_BITS[static_cast<unsigned char>(c)]) {}
+
+fsweep::Button::Button(fsweep::ButtonState button_state, bool has_bomb) noexcept
+{
+  this->SetButtonState(button_state);
+  this->SetHasBomb(has_bomb);
+}
+
+void fsweep::Button::SetButtonState(fsweep::ButtonState button_state) noexcept
+{
+  this->bits = (this->bits & ~BUTTON_STATE_MASK) | static_cast<std::uint8_t>(button_state);
 }
 
 void fsweep::Button::Unpress() noexcept
 {
-  if (this->button_state == fsweep::ButtonState::Down)
+  if (this->GetButtonState() == fsweep::ButtonState::Down)
   {
-    this->button_state = fsweep::ButtonState::None;
+    this->SetButtonState(fsweep::ButtonState::None);
   }
 }
 
 void fsweep::Button::Press() noexcept
 {
-  if (this->button_state != fsweep::ButtonState::Flagged)
+  if (this->GetButtonState() != fsweep::ButtonState::Flagged)
   {
-    this->button_state = fsweep::ButtonState::Down;
+    this->SetButtonState(fsweep::ButtonState::Down);
   }
 }
 
 void fsweep::Button::AltPress(bool questions_enabled) noexcept
 {
-  if (this->button_state == fsweep::ButtonState::None)
+  const auto button_state = this->GetButtonState();
+  if (button_state == fsweep::ButtonState::None)
   {
-    this->button_state = fsweep::ButtonState::Flagged;
+    this->SetButtonState(fsweep::ButtonState::Flagged);
   }
-  else if (this->button_state == fsweep::ButtonState::Flagged)
+  else if (button_state == fsweep::ButtonState::Flagged)
   {
     if (questions_enabled)
     {
-      this->button_state = fsweep::ButtonState::Questioned;
+      this->SetButtonState(fsweep::ButtonState::Questioned);
     }
     else
     {
-      this->button_state = fsweep::ButtonState::None;
+      this->SetButtonState(fsweep::ButtonState::None);
     }
   }
-  else if (this->button_state == fsweep::ButtonState::Questioned)
+  else if (button_state == fsweep::ButtonState::Questioned)
   {
-    this->button_state = fsweep::ButtonState::None;
+    this->SetButtonState(fsweep::ButtonState::None);
   }
 }
 
 void fsweep::Button::RemoveQuestion() noexcept
 {
-  if (this->button_state == fsweep::ButtonState::Questioned)
+  if (this->GetButtonState() == fsweep::ButtonState::Questioned)
   {
-    this->button_state = fsweep::ButtonState::None;
+    this->SetButtonState(fsweep::ButtonState::None);
   }
 }
 
-void fsweep::Button::SetHasBomb(bool has_bomb) noexcept { this->has_bomb = has_bomb; }
+void fsweep::Button::SetHasBomb(bool has_bomb) noexcept
+{
+  if (has_bomb)
+  {
+    this->bits |= HAS_BOMB_MASK;
+  }
+  else
+  {
+    this->bits &= ~HAS_BOMB_MASK;
+  }
+}
 
 void fsweep::Button::SetSurroundingBombs(int surrounding_bombs) noexcept
 {
-  this->surrounding_bombs = surrounding_bombs;
+  this->bits = (this->bits & ~SURROUNDING_BOMBS_MASK) |
+               ((surrounding_bombs << SURROUNDING_BOMBS_SHIFT) & SURROUNDING_BOMBS_MASK);
 }
 
-void fsweep::Button::AddSurroundingBomb() noexcept { this->surrounding_bombs++; }
+void fsweep::Button::AddSurroundingBomb() noexcept
+{
+  this->SetSurroundingBombs(this->GetSurroundingBombs() + 1);
+}
+
+void fsweep::Button::SetIsCounted(bool is_counted) noexcept
+{
+  if (is_counted)
+  {
+    this->bits |= IS_COUNTED_MASK;
+  }
+  else
+  {
+    this->bits &= ~IS_COUNTED_MASK;
+  }
+}
 
 bool fsweep::Button::GetIsPressable() const noexcept
 {
-  return this->button_state != fsweep::ButtonState::Down &&
-         this->button_state != fsweep::ButtonState::Flagged;
+  const auto button_state = this->GetButtonState();
+  return button_state != fsweep::ButtonState::Down && button_state != fsweep::ButtonState::Flagged;
+}
+
+bool fsweep::Button::GetHasBomb() const noexcept { return (this->bits & HAS_BOMB_MASK) != 0; }
+
+int fsweep::Button::GetSurroundingBombs() const noexcept
+{
+  return (this->bits & SURROUNDING_BOMBS_MASK) >> SURROUNDING_BOMBS_SHIFT;
+}
+
+bool fsweep::Button::GetIsCounted() const noexcept { return (this->bits & IS_COUNTED_MASK) != 0; }
+
+fsweep::ButtonState fsweep::Button::GetButtonState() const noexcept
+{
+  return static_cast<fsweep::ButtonState>(this->bits & BUTTON_STATE_MASK);
+}
+
+char fsweep::Button::ToChar() const noexcept
+{
+  return BITS_CHARS[this->bits & (BUTTON_STATE_MASK | HAS_BOMB_MASK)];
 }
 
-bool fsweep::Button::GetHasBomb() const noexcept { return this->has_bomb; }
+void fsweep::Button::FromChars(std::string_view chars, std::span<fsweep::Button> buttons) noexcept
+{
+  const auto count = std::min(chars.size(), buttons.size());
+  for (std::size_t button_i = 0; button_i < count; button_i++)
+  {
+    buttons[button_i].bits = CHAR_BITS[static_cast<unsigned char>(chars[button_i])];
+  }
+}
 
-int fsweep::Button::GetSurroundingBombs() const noexcept { return this->surrounding_bombs; }
+void fsweep::Button::ToChars(std::span<const fsweep::Button> buttons,
+                             std::span<char> chars) noexcept
+{
+  const auto count = std::min(chars.size(), buttons.size());
+  for (std::size_t button_i = 0; button_i < count; button_i++)
+  {
+    chars[button_i] = BITS_CHARS[buttons[button_i].bits & (BUTTON_STATE_MASK | HAS_BOMB_MASK)];
+  }
+}
 
-fsweep::ButtonState fsweep::Button::GetButtonState() const noexcept { return this->button_state; }
\ No newline at end of file
+std::size_t fsweep::Button::CountButtonState(std::span<const fsweep::Button> buttons,
+                                             fsweep::ButtonState button_state) noexcept
+{
+  // a branchless sum over the raw bits so the compiler can vectorize it
+  const auto state_bits = static_cast<std::uint8_t>(button_state);
+  std::size_t state_count = 0;
+  for (const auto& button : buttons)
+  {
+    state_count += (button.bits & BUTTON_STATE_MASK) == state_bits;
+  }
+  return state_count;
+}
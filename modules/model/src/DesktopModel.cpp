@@ -26,6 +26,7 @@
 #include <fsweep/Point.hpp>
 #include <fsweep/Sprite.hpp>
 #include <fsweep/Timer.hpp>
+#include <fsweep/Trace.hpp>
 #include <functional>
 #include <utility>
 
@@ -41,10 +42,15 @@ bool fsweep::DesktopModel::TryChangePixelScale(int new_pixel_scale)
   return true;
 }
 
-void fsweep::DesktopModel::LeftPress() { this->left_down = true; }
+void fsweep::DesktopModel::LeftPress()
+{
+  FSWEEP_TRACE_ZONE("DesktopModel::LeftPress");
+  this->left_down = true;
+}
 
 void fsweep::DesktopModel::LeftRelease(fsweep::Timer& timer)
 {
+  FSWEEP_TRACE_ZONE("DesktopModel::LeftRelease");
   auto& game_model = this->game_model.get();
   if (game_model.GetGameState() == fsweep::GameState::Playing)
   {
@@ -82,6 +88,7 @@ void fsweep::DesktopModel::LeftRelease(fsweep::Timer& timer)
 
 void fsweep::DesktopModel::RightPress(fsweep::Timer& timer)
 {
+  FSWEEP_TRACE_ZONE("DesktopModel::RightPress");
   auto& game_model = this->game_model.get();
   this->right_down = true;
   if (game_model.GetGameState() == fsweep::GameState::Playing)
@@ -97,6 +104,7 @@ void fsweep::DesktopModel::RightPress(fsweep::Timer& timer)
 
 void fsweep::DesktopModel::RightRelease(fsweep::Timer& timer)
 {
+  FSWEEP_TRACE_ZONE("DesktopModel::RightRelease");
   auto& game_model = this->game_model.get();
   auto initially_playing = game_model.GetGameState() == fsweep::GameState::Playing;
   if (this->hover_button_o.has_value() && this->left_down)
@@ -112,10 +120,15 @@ void fsweep::DesktopModel::RightRelease(fsweep::Timer& timer)
   this->right_down = false;
 }
 
-void fsweep::DesktopModel::MouseLeave() { this->hover_button_o = std::nullopt; }
+void fsweep::DesktopModel::MouseLeave()
+{
+  FSWEEP_TRACE_ZONE("DesktopModel::MouseLeave");
+  this->hover_button_o = std::nullopt;
+}
 
 void fsweep::DesktopModel::MouseMove(int x, int y)
 {
+  FSWEEP_TRACE_ZONE("DesktopModel::MouseMove");
   this->hover_button_o = std::nullopt;
   if (x >= this->GetBorderSize() && x < this->GetSize().x - this->GetBorderSize() &&
       y >= this->GetHeaderHeight() && y < this->GetSize().y - this->GetBorderSize())
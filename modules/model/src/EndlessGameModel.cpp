@@ -0,0 +1,331 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *model
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <fsweep/BombOracle.hpp>
+#include <fsweep/CounterRng.hpp>
+#include <fsweep/EndlessGameModel.hpp>
+#include <fsweep/Trace.hpp>
+
+const double fsweep::EndlessGameModel::MIN_BOMB_DENSITY = 0.15;
+const double fsweep::EndlessGameModel::MAX_BOMB_DENSITY = 0.9;
+const double fsweep::EndlessGameModel::DEFAULT_BOMB_DENSITY = 0.2;
+
+std::size_t fsweep::EndlessPositionHash::operator()(
+    const fsweep::EndlessPosition& position) const noexcept
+{
+  return static_cast<std::size_t>(fsweep::CounterRng::Get(0, static_cast<std::uint64_t>(position.x),
+                                                          static_cast<std::uint64_t>(position.y)));
+}
+
+fsweep::EndlessGameModel::EndlessGameModel(std::uint64_t seed, double bomb_density)
+    : seed(seed)
+    // below 15% density the openings can percolate and a single click would never finish
+    , bomb_density(std::clamp(bomb_density, fsweep::EndlessGameModel::MIN_BOMB_DENSITY,
+                              fsweep::EndlessGameModel::MAX_BOMB_DENSITY))
+{
+  this->bomb_threshold = fsweep::BombOracle::GetBombThreshold(this->bomb_density);
+}
+
+fsweep::EndlessPosition fsweep::EndlessGameModel::getChunkPosition(std::int64_t x,
+                                                                   std::int64_t y) noexcept
+{
+  // shifting rounds towards negative infinity, so negative positions get their own chunks
+  static_assert(fsweep::EndlessGameModel::CHUNK_BUTTONS_WIDE == 64);
+  static_assert(fsweep::EndlessGameModel::CHUNK_BUTTONS_TALL == 64);
+  return fsweep::EndlessPosition{x >> 6, y >> 6};
+}
+
+std::size_t fsweep::EndlessGameModel::getChunkIndex(std::int64_t x, std::int64_t y) noexcept
+{
+  const auto chunk_x =
+      static_cast<std::size_t>(x & (fsweep::EndlessGameModel::CHUNK_BUTTONS_WIDE - 1));
+  const auto chunk_y =
+      static_cast<std::size_t>(y & (fsweep::EndlessGameModel::CHUNK_BUTTONS_TALL - 1));
+  return (chunk_y * fsweep::EndlessGameModel::CHUNK_BUTTONS_WIDE) + chunk_x;
+}
+
+fsweep::Button fsweep::EndlessGameModel::makeButton(std::int64_t x, std::int64_t y) const noexcept
+{
+  fsweep::Button button;
+  button.SetHasBomb(this->HasBomb(x, y));
+  int surrounding_bombs = 0;
+  for (std::int64_t neighbour_y = y - 1; neighbour_y <= y + 1; neighbour_y++)
+  {
+    for (std::int64_t neighbour_x = x - 1; neighbour_x <= x + 1; neighbour_x++)
+    {
+      if ((neighbour_x != x || neighbour_y != y) && this->HasBomb(neighbour_x, neighbour_y))
+      {
+        surrounding_bombs++;
+      }
+    }
+  }
+  button.SetSurroundingBombs(surrounding_bombs);
+  return button;
+}
+
+fsweep::EndlessGameModel::Chunk& fsweep::EndlessGameModel::getChunk(
+    const fsweep::EndlessPosition& chunk_position)
+{
+  auto [chunk_it, inserted] = this->chunks.try_emplace(chunk_position);
+  auto& chunk = chunk_it->second;
+  if (!inserted) return chunk;
+  FSWEEP_TRACE_ZONE("EndlessGameModel::generateChunk");
+  const auto buttons_wide = fsweep::EndlessGameModel::CHUNK_BUTTONS_WIDE;
+  const auto buttons_tall = fsweep::EndlessGameModel::CHUNK_BUTTONS_TALL;
+  const auto plane_wide = buttons_wide + 2;
+  const auto plane_tall = buttons_tall + 2;
+  const auto origin_x = chunk_position.x * buttons_wide;
+  const auto origin_y = chunk_position.y * buttons_tall;
+  // the bombs of the chunk and a one Button border derived from the neighbouring chunks' seeds
+  std::array<bool, plane_wide * plane_tall> bomb_plane{};
+  for (int plane_y = 0; plane_y < plane_tall; plane_y++)
+  {
+    for (int plane_x = 0; plane_x < plane_wide; plane_x++)
+    {
+      bomb_plane[(plane_y * plane_wide) + plane_x] =
+          this->HasBomb(origin_x + plane_x - 1, origin_y + plane_y - 1);
+    }
+  }
+  for (int y = 0; y < buttons_tall; y++)
+  {
+    for (int x = 0; x < buttons_wide; x++)
+    {
+      const auto plane_i = ((y + 1) * plane_wide) + x + 1;
+      auto& button = chunk[(y * buttons_wide) + x];
+      button.SetHasBomb(bomb_plane[plane_i]);
+      button.SetSurroundingBombs(
+          bomb_plane[plane_i - plane_wide - 1] + bomb_plane[plane_i - plane_wide] +
+          bomb_plane[plane_i - plane_wide + 1] + bomb_plane[plane_i - 1] + bomb_plane[plane_i + 1] +
+          bomb_plane[plane_i + plane_wide - 1] + bomb_plane[plane_i + plane_wide] +
+          bomb_plane[plane_i + plane_wide + 1]);
+    }
+  }
+  return chunk;
+}
+
+fsweep::Button& fsweep::EndlessGameModel::getButton(std::int64_t x, std::int64_t y)
+{
+  auto& chunk = this->getChunk(fsweep::EndlessGameModel::getChunkPosition(x, y));
+  return chunk[fsweep::EndlessGameModel::getChunkIndex(x, y)];
+}
+
+void fsweep::EndlessGameModel::refreshButtons(std::int64_t x, std::int64_t y)
+{
+  // Buttons near the first click can change once it is known, but only in chunks touched before it
+  for (std::int64_t refresh_y = y - 2; refresh_y <= y + 2; refresh_y++)
+  {
+    for (std::int64_t refresh_x = x - 2; refresh_x <= x + 2; refresh_x++)
+    {
+      const auto chunk_it =
+          this->chunks.find(fsweep::EndlessGameModel::getChunkPosition(refresh_x, refresh_y));
+      if (chunk_it == this->chunks.end()) continue;
+      auto& button =
+          chunk_it->second[fsweep::EndlessGameModel::getChunkIndex(refresh_x, refresh_y)];
+      const auto refreshed_button = this->makeButton(refresh_x, refresh_y);
+      button.SetHasBomb(refreshed_button.GetHasBomb());
+      button.SetSurroundingBombs(refreshed_button.GetSurroundingBombs());
+    }
+  }
+}
+
+void fsweep::EndlessGameModel::pressButton(std::int64_t x, std::int64_t y)
+{
+  auto& button = this->getButton(x, y);
+  if (button.GetIsPressable())
+  {
+    if (button.GetHasBomb())
+    {
+      button.Press();
+      this->game_state = fsweep::GameState::Dead;
+    }
+    else
+    {
+      this->floodFillClick(x, y);
+    }
+  }
+}
+
+void fsweep::EndlessGameModel::floodFillClick(std::int64_t x, std::int64_t y)
+{
+  FSWEEP_TRACE_ZONE("EndlessGameModel::floodFillClick");
+  this->getButton(x, y).Press();
+  this->buttons_pressed++;
+  this->flood_fill_stack.clear();
+  this->flood_fill_stack.push_back(fsweep::EndlessPosition{x, y});
+  do
+  {
+    const auto cur_position = this->flood_fill_stack.back();
+    this->flood_fill_stack.pop_back();
+    if (this->getButton(cur_position.x, cur_position.y).GetSurroundingBombs() != 0) continue;
+    for (std::int64_t neighbour_y = cur_position.y - 1; neighbour_y <= cur_position.y + 1;
+         neighbour_y++)
+    {
+      for (std::int64_t neighbour_x = cur_position.x - 1; neighbour_x <= cur_position.x + 1;
+           neighbour_x++)
+      {
+        // Buttons are pressed as they are found so each one is only pushed once
+        auto& button = this->getButton(neighbour_x, neighbour_y);
+        if (button.GetIsPressable())
+        {
+          button.Press();
+          this->buttons_pressed++;
+          this->flood_fill_stack.push_back(fsweep::EndlessPosition{neighbour_x, neighbour_y});
+        }
+      }
+    }
+  } while (!this->flood_fill_stack.empty());
+  FSWEEP_TRACE_COUNTER("buttons_pressed", this->buttons_pressed);
+}
+
+void fsweep::EndlessGameModel::NewGame()
+{
+  FSWEEP_TRACE_ZONE("EndlessGameModel::NewGame");
+  this->chunks.clear();
+  this->game_state = fsweep::GameState::None;
+  this->flag_count = 0;
+  this->buttons_pressed = 0;
+}
+
+void fsweep::EndlessGameModel::NewGame(std::uint64_t seed)
+{
+  this->seed = seed;
+  this->NewGame();
+}
+
+void fsweep::EndlessGameModel::ClickButton(std::int64_t x, std::int64_t y)
+{
+  FSWEEP_TRACE_ZONE("EndlessGameModel::ClickButton");
+  if (this->game_state != fsweep::GameState::Playing && this->game_state != fsweep::GameState::None)
+    return;
+  if (this->getButton(x, y).GetButtonState() == fsweep::ButtonState::Flagged) return;
+  if (this->game_state == fsweep::GameState::None)
+  {
+    this->first_position = fsweep::EndlessPosition{x, y};
+    this->game_state = fsweep::GameState::Playing;
+    this->refreshButtons(x, y);
+  }
+  this->pressButton(x, y);
+}
+
+void fsweep::EndlessGameModel::AltClickButton(std::int64_t x, std::int64_t y)
+{
+  FSWEEP_TRACE_ZONE("EndlessGameModel::AltClickButton");
+  if (this->game_state == fsweep::GameState::Dead || this->game_state == fsweep::GameState::Cool) return;
+  auto& button = this->getButton(x, y);
+  if (button.GetButtonState() == fsweep::ButtonState::Flagged)
+  {
+    this->flag_count--;
+  }
+  button.AltPress(this->questions_enabled);
+  if (button.GetButtonState() == fsweep::ButtonState::Flagged)
+  {
+    this->flag_count++;
+  }
+}
+
+void fsweep::EndlessGameModel::AreaClickButton(std::int64_t x, std::int64_t y)
+{
+  FSWEEP_TRACE_ZONE("EndlessGameModel::AreaClickButton");
+  if (this->game_state != fsweep::GameState::Playing) return;
+  const auto center_button = this->getButton(x, y);
+  if (center_button.GetButtonState() != fsweep::ButtonState::Down) return;
+  int surrounding_flags = 0;
+  for (std::int64_t neighbour_y = y - 1; neighbour_y <= y + 1; neighbour_y++)
+  {
+    for (std::int64_t neighbour_x = x - 1; neighbour_x <= x + 1; neighbour_x++)
+    {
+      if (this->getButton(neighbour_x, neighbour_y).GetButtonState() ==
+          fsweep::ButtonState::Flagged)
+      {
+        surrounding_flags++;
+      }
+    }
+  }
+  if (surrounding_flags != center_button.GetSurroundingBombs()) return;
+  for (std::int64_t neighbour_y = y - 1; neighbour_y <= y + 1; neighbour_y++)
+  {
+    for (std::int64_t neighbour_x = x - 1; neighbour_x <= x + 1; neighbour_x++)
+    {
+      this->pressButton(neighbour_x, neighbour_y);
+    }
+  }
+}
+
+void fsweep::EndlessGameModel::SetQuestionsEnabled(bool questions_enabled)
+{
+  if (this->questions_enabled == questions_enabled) return;
+  if (!questions_enabled)
+  {
+    for (auto& [chunk_position, chunk] : this->chunks)
+    {
+      for (auto& button : chunk)
+      {
+        button.RemoveQuestion();
+      }
+    }
+  }
+  this->questions_enabled = questions_enabled;
+}
+
+bool fsweep::EndlessGameModel::GetQuestionsEnabled() const noexcept
+{
+  return this->questions_enabled;
+}
+
+bool fsweep::EndlessGameModel::HasBomb(std::int64_t x, std::int64_t y) const noexcept
+{
+  // the first click opens the Buttons around it, like GameModel does for finite boards
+  if (this->game_state != fsweep::GameState::None && x >= this->first_position.x - 1 &&
+      x <= this->first_position.x + 1 && y >= this->first_position.y - 1 &&
+      y <= this->first_position.y + 1)
+  {
+    return false;
+  }
+  return fsweep::BombOracle::HasBomb(this->seed, x, y, this->bomb_threshold);
+}
+
+fsweep::Button fsweep::EndlessGameModel::GetButton(std::int64_t x, std::int64_t y) const noexcept
+{
+  const auto chunk_it = this->chunks.find(fsweep::EndlessGameModel::getChunkPosition(x, y));
+  if (chunk_it == this->chunks.end()) return this->makeButton(x, y);
+  return chunk_it->second[fsweep::EndlessGameModel::getChunkIndex(x, y)];
+}
+
+fsweep::GameState fsweep::EndlessGameModel::GetGameState() const noexcept
+{
+  return this->game_state;
+}
+
+std::int64_t fsweep::EndlessGameModel::GetFlagCount() const noexcept { return this->flag_count; }
+
+std::uint64_t fsweep::EndlessGameModel::GetButtonsPressed() const noexcept
+{
+  return this->buttons_pressed;
+}
+
+std::uint64_t fsweep::EndlessGameModel::GetSeed() const noexcept { return this->seed; }
+
+double fsweep::EndlessGameModel::GetBombDensity() const noexcept { return this->bomb_density; }
+
+std::size_t fsweep::EndlessGameModel::GetChunkCount() const noexcept { return this->chunks.size(); }
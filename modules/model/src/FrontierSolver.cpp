@@ -0,0 +1,319 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/FrontierSolver.hpp>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+const std::size_t fsweep::FrontierSolver::MAX_COMPONENT_COLUMNS = 1024;
+
+const std::size_t WORD_BITS = 64;
+const std::int64_t MAX_COEFFICIENT = std::numeric_limits<std::int32_t>::max();
+const std::int8_t UNKNOWN_VALUE = -1;
+
+namespace
+{
+  std::size_t findSolverRoot(std::vector<std::size_t>& parents, std::size_t column_i)
+  {
+    while (parents[column_i] != column_i)
+    {
+      parents[column_i] = parents[parents[column_i]];
+      column_i = parents[column_i];
+    }
+    return column_i;
+  }
+
+  // replaces row with row * pivot_coefficient - pivot_row * coefficient and divides it by the
+  // greatest common divisor of its entries, returning false if an entry would overflow
+  bool eliminateSolverRow(std::span<std::int32_t> row, std::int32_t& value,
+                          std::span<std::uint64_t> support, std::span<const std::int32_t> pivot_row,
+                          std::int32_t pivot_value, std::span<const std::uint64_t> pivot_support,
+                          std::size_t column_i)
+  {
+    const std::int64_t coefficient = row[column_i];
+    const std::int64_t pivot_coefficient = pivot_row[column_i];
+    bool overflow = false;
+    std::int64_t divisor = 0;
+    for (std::size_t word_i = 0; word_i < support.size(); word_i++)
+    {
+      if ((support[word_i] | pivot_support[word_i]) == 0) continue;
+      const auto begin = word_i * WORD_BITS;
+      const auto end = std::min(begin + WORD_BITS, row.size());
+      for (std::size_t entry_i = begin; entry_i < end; entry_i++)
+      {
+        const std::int64_t entry =
+            row[entry_i] * pivot_coefficient - pivot_row[entry_i] * coefficient;
+        overflow = overflow || entry > MAX_COEFFICIENT || entry < -MAX_COEFFICIENT;
+        row[entry_i] = static_cast<std::int32_t>(entry);
+        divisor = std::gcd(divisor, entry);
+      }
+    }
+    const std::int64_t new_value = value * pivot_coefficient - pivot_value * coefficient;
+    if (overflow || new_value > MAX_COEFFICIENT || new_value < -MAX_COEFFICIENT) return false;
+    divisor = std::gcd(divisor, new_value);
+    value = static_cast<std::int32_t>(new_value);
+    for (std::size_t word_i = 0; word_i < support.size(); word_i++)
+    {
+      if ((support[word_i] | pivot_support[word_i]) == 0) continue;
+      const auto begin = word_i * WORD_BITS;
+      const auto end = std::min(begin + WORD_BITS, row.size());
+      std::uint64_t word = 0;
+      for (std::size_t entry_i = begin; entry_i < end; entry_i++)
+      {
+        if (divisor > 1) row[entry_i] = static_cast<std::int32_t>(row[entry_i] / divisor);
+        word |= static_cast<std::uint64_t>(row[entry_i] != 0) << (entry_i - begin);
+      }
+      support[word_i] = word;
+    }
+    if (divisor > 1) value = static_cast<std::int32_t>(value / divisor);
+    return true;
+  }
+}  // namespace
+
+void fsweep::FrontierSolver::AddConstraint(std::span<const std::size_t> button_is, int bomb_count)
+{
+  if (button_is.empty()) return;
+  this->constraint_starts.push_back(this->button_is.size());
+  this->button_is.insert(this->button_is.end(), button_is.begin(), button_is.end());
+  this->bomb_counts.push_back(bomb_count);
+}
+
+void fsweep::FrontierSolver::Clear() noexcept
+{
+  this->button_is.clear();
+  this->constraint_starts.clear();
+  this->bomb_counts.clear();
+  this->safe_button_is.clear();
+  this->bomb_button_is.clear();
+}
+
+void fsweep::FrontierSolver::Solve()
+{
+  this->safe_button_is.clear();
+  this->bomb_button_is.clear();
+  const auto constraint_count = this->constraint_starts.size();
+  const auto get_constraint = [this, constraint_count](std::size_t constraint_i)
+  {
+    const auto begin = this->constraint_starts[constraint_i];
+    const auto end = constraint_i + 1 < constraint_count ? this->constraint_starts[constraint_i + 1]
+                                                         : this->button_is.size();
+    return std::span<const std::size_t>(this->button_is.data() + begin, end - begin);
+  };
+
+  // constraints that share a Button end up in the same component
+  std::unordered_map<std::size_t, std::size_t> column_is;
+  for (const auto button_i : this->button_is)
+  {
+    column_is.emplace(button_i, column_is.size());
+  }
+  std::vector<std::size_t> parents(column_is.size());
+  std::iota(parents.begin(), parents.end(), 0);
+  for (std::size_t constraint_i = 0; constraint_i < constraint_count; constraint_i++)
+  {
+    const auto constraint = get_constraint(constraint_i);
+    const auto root = findSolverRoot(parents, column_is[constraint.front()]);
+    for (const auto button_i : constraint)
+    {
+      parents[findSolverRoot(parents, column_is[button_i])] = root;
+    }
+  }
+  std::vector<std::pair<std::size_t, std::size_t>> component_constraints;
+  component_constraints.reserve(constraint_count);
+  for (std::size_t constraint_i = 0; constraint_i < constraint_count; constraint_i++)
+  {
+    const auto root = findSolverRoot(parents, column_is[get_constraint(constraint_i).front()]);
+    component_constraints.emplace_back(root, constraint_i);
+  }
+  std::sort(component_constraints.begin(), component_constraints.end());
+
+  std::vector<std::size_t> constraint_is;
+  std::vector<std::size_t> column_button_is;
+  for (std::size_t begin = 0; begin < component_constraints.size();)
+  {
+    auto end = begin;
+    constraint_is.clear();
+    column_button_is.clear();
+    while (end < component_constraints.size() &&
+           component_constraints[end].first == component_constraints[begin].first)
+    {
+      const auto constraint_i = component_constraints[end].second;
+      constraint_is.push_back(constraint_i);
+      const auto constraint = get_constraint(constraint_i);
+      column_button_is.insert(column_button_is.end(), constraint.begin(), constraint.end());
+      end++;
+    }
+    // ordering the columns by Button keeps the rows of a frontier banded
+    std::sort(column_button_is.begin(), column_button_is.end());
+    column_button_is.erase(std::unique(column_button_is.begin(), column_button_is.end()),
+                           column_button_is.end());
+    this->solveComponent(constraint_is, column_button_is);
+    begin = end;
+  }
+}
+
+bool fsweep::FrontierSolver::solveComponent(std::span<const std::size_t> constraint_is,
+                                            std::span<const std::size_t> column_button_is)
+{
+  const auto column_count = column_button_is.size();
+  if (column_count > fsweep::FrontierSolver::MAX_COMPONENT_COLUMNS) return false;
+  const auto row_count = constraint_is.size();
+  const auto word_count = (column_count + WORD_BITS - 1) / WORD_BITS;
+  this->coefficients.assign(row_count * column_count, 0);
+  this->values.assign(row_count, 0);
+  this->supports.assign(row_count * word_count, 0);
+  const auto get_row = [&](std::size_t row_i)
+  {
+    return std::span<std::int32_t>(this->coefficients.data() + row_i * column_count,
+                                   column_count);
+  };
+  const auto get_support = [&](std::size_t row_i)
+  {
+    return std::span<std::uint64_t>(this->supports.data() + row_i * word_count, word_count);
+  };
+  for (std::size_t row_i = 0; row_i < row_count; row_i++)
+  {
+    const auto constraint_i = constraint_is[row_i];
+    const auto begin = this->constraint_starts[constraint_i];
+    const auto end = constraint_i + 1 < this->constraint_starts.size()
+                         ? this->constraint_starts[constraint_i + 1]
+                         : this->button_is.size();
+    for (auto button_i = begin; button_i < end; button_i++)
+    {
+      const auto column_i = static_cast<std::size_t>(
+          std::lower_bound(column_button_is.begin(), column_button_is.end(),
+                           this->button_is[button_i]) -
+          column_button_is.begin());
+      get_row(row_i)[column_i] = 1;
+      get_support(row_i)[column_i / WORD_BITS] |= std::uint64_t(1) << (column_i % WORD_BITS);
+    }
+    this->values[row_i] = this->bomb_counts[constraint_i];
+  }
+
+  // reduce to row echelon form, eliminating each pivot column from every other row
+  std::size_t pivot_i = 0;
+  for (std::size_t column_i = 0; column_i < column_count && pivot_i < row_count; column_i++)
+  {
+    const auto word_i = column_i / WORD_BITS;
+    const auto bit = std::uint64_t(1) << (column_i % WORD_BITS);
+    auto row_i = pivot_i;
+    while (row_i < row_count && (get_support(row_i)[word_i] & bit) == 0)
+    {
+      row_i++;
+    }
+    if (row_i == row_count) continue;
+    if (row_i != pivot_i)
+    {
+      std::swap_ranges(get_row(row_i).begin(), get_row(row_i).end(), get_row(pivot_i).begin());
+      std::swap_ranges(get_support(row_i).begin(), get_support(row_i).end(),
+                       get_support(pivot_i).begin());
+      std::swap(this->values[row_i], this->values[pivot_i]);
+    }
+    for (row_i = 0; row_i < row_count; row_i++)
+    {
+      if (row_i == pivot_i || (get_support(row_i)[word_i] & bit) == 0) continue;
+      if (!eliminateSolverRow(get_row(row_i), this->values[row_i], get_support(row_i),
+                              get_row(pivot_i), this->values[pivot_i], get_support(pivot_i),
+                              column_i))
+      {
+        return false;
+      }
+    }
+    pivot_i++;
+  }
+
+  // a row at the bound of its possible sums decides every Button in it, which is substituted
+  // into the other rows until no row decides anything more
+  std::vector<std::int8_t> column_values(column_count, UNKNOWN_VALUE);
+  const auto substitute = [&](std::size_t column_i, std::int8_t column_value)
+  {
+    column_values[column_i] = column_value;
+    const auto word_i = column_i / WORD_BITS;
+    const auto bit = std::uint64_t(1) << (column_i % WORD_BITS);
+    for (std::size_t row_i = 0; row_i < row_count; row_i++)
+    {
+      if ((get_support(row_i)[word_i] & bit) == 0) continue;
+      this->values[row_i] -= get_row(row_i)[column_i] * column_value;
+      get_row(row_i)[column_i] = 0;
+      get_support(row_i)[word_i] &= ~bit;
+    }
+  };
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+    for (std::size_t row_i = 0; row_i < row_count; row_i++)
+    {
+      const auto row = get_row(row_i);
+      const auto support = get_support(row_i);
+      std::int64_t lowest_sum = 0;
+      std::int64_t highest_sum = 0;
+      bool is_empty = true;
+      for (std::size_t word_i = 0; word_i < word_count; word_i++)
+      {
+        for (auto word = support[word_i]; word != 0; word &= word - 1)
+        {
+          const auto coefficient = row[word_i * WORD_BITS + std::countr_zero(word)];
+          lowest_sum += std::min(coefficient, 0);
+          highest_sum += std::max(coefficient, 0);
+          is_empty = false;
+        }
+      }
+      const auto value = this->values[row_i];
+      if (is_empty || (value != lowest_sum && value != highest_sum)) continue;
+      // at the lowest sum every negative column holds a bomb, at the highest every positive one
+      const int bomb_sign = value == lowest_sum ? -1 : 1;
+      for (std::size_t word_i = 0; word_i < word_count; word_i++)
+      {
+        for (auto word = support[word_i]; word != 0; word &= word - 1)
+        {
+          const auto column_i = word_i * WORD_BITS + std::countr_zero(word);
+          const bool has_bomb = (row[column_i] > 0) == (bomb_sign > 0);
+          substitute(column_i, has_bomb ? 1 : 0);
+        }
+      }
+      changed = true;
+    }
+  }
+  for (std::size_t column_i = 0; column_i < column_count; column_i++)
+  {
+    if (column_values[column_i] == 0) this->safe_button_is.push_back(column_button_is[column_i]);
+    if (column_values[column_i] == 1) this->bomb_button_is.push_back(column_button_is[column_i]);
+  }
+  return true;
+}
+
+std::span<const std::size_t> fsweep::FrontierSolver::GetSafeButtons() const noexcept
+{
+  return this->safe_button_is;
+}
+
+std::span<const std::size_t> fsweep::FrontierSolver::GetBombButtons() const noexcept
+{
+  return this->bomb_button_is;
+}
@@ -21,20 +21,9 @@
  */
 
 #include <algorithm>
+#include <cstddef>
 #include <fsweep/GameConfiguration.hpp>
-
-const int fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE = 8;
-const int fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL = 8;
-const int fsweep::GameConfiguration::BEGINNER_BOMB_COUNT = 10;
-const int fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_WIDE = 16;
-const int fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_TALL = 16;
-const int fsweep::GameConfiguration::INTERMEDIATE_BOMB_COUNT = 40;
-const int fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE = 30;
-const int fsweep::GameConfiguration::EXPERT_BUTTONS_TALL = 16;
-const int fsweep::GameConfiguration::EXPERT_BOMB_COUNT = 99;
-const int fsweep::GameConfiguration::MIN_BUTTONS_WIDE = 8;
-const int fsweep::GameConfiguration::MIN_BUTTONS_TALL = 1;
-const int fsweep::GameConfiguration::MIN_BOMB_COUNT = 0;
+#include <limits>
 
 fsweep::GameConfiguration::GameConfiguration(fsweep::GameDifficulty game_difficulty) noexcept
 {
@@ -87,11 +76,14 @@ fsweep::GameConfiguration::GameConfiguration(int buttons_wide, int buttons_tall,
   {
     this->game_difficulty = fsweep::GameDifficulty::Custom;
   }
-  this->buttons_wide = std::max(buttons_wide, fsweep::GameConfiguration::MIN_BUTTONS_WIDE);
-  this->buttons_tall = std::max(buttons_tall, fsweep::GameConfiguration::MIN_BUTTONS_TALL);
-  const int button_count = this->buttons_wide * this->buttons_tall;
+  this->buttons_wide = std::clamp(buttons_wide, fsweep::GameConfiguration::MIN_BUTTONS_WIDE,
+                                  fsweep::GameConfiguration::MAX_BUTTONS_WIDE);
+  this->buttons_tall = std::clamp(buttons_tall, fsweep::GameConfiguration::MIN_BUTTONS_TALL,
+                                  fsweep::GameConfiguration::MAX_BUTTONS_TALL);
+  const auto max_bomb_count = static_cast<int>(std::min<std::size_t>(
+      this->GetButtonCount(), static_cast<std::size_t>(std::numeric_limits<int>::max())));
   this->bomb_count =
-      std::clamp(bomb_count, fsweep::GameConfiguration::MIN_BOMB_COUNT, button_count);
+      std::clamp(bomb_count, fsweep::GameConfiguration::MIN_BOMB_COUNT, max_bomb_count);
 }
 
 bool fsweep::GameConfiguration::operator==(const fsweep::GameConfiguration& other) const noexcept
@@ -115,7 +107,7 @@ std::strong_ordering fsweep::GameConfiguration::operator<=>(
 {
   if (this->game_difficulty == other.game_difficulty)
   {
-    return this->buttons_wide * this->buttons_tall <=> other.buttons_wide * other.buttons_tall;
+    return this->GetButtonCount() <=> other.GetButtonCount();
   }
   return static_cast<int>(this->game_difficulty) <=> static_cast<int>(other.game_difficulty);
 }
@@ -131,7 +123,8 @@ int fsweep::GameConfiguration::GetButtonsTall() const noexcept { return this->bu
 
 int fsweep::GameConfiguration::GetBombCount() const noexcept { return this->bomb_count; }
 
-int fsweep::GameConfiguration::GetButtonCount() const noexcept
+std::size_t fsweep::GameConfiguration::GetButtonCount() const noexcept
 {
-  return static_cast<std::size_t>(this->buttons_wide * this->buttons_tall);
+  return static_cast<std::size_t>(this->buttons_wide) *
+         static_cast<std::size_t>(this->buttons_tall);
 }
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *model
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fsweep/GameFile.hpp>
+#include <fsweep/MappedFile.hpp>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+const std::uint32_t fsweep::GameFile::MAGIC = 0x50575346;  // "FSWP"
+const std::uint16_t fsweep::GameFile::VERSION = 1;
+const std::size_t fsweep::GameFile::HEADER_SIZE = 40;
+const std::uint8_t fsweep::GameFile::QUESTIONS_ENABLED_FLAG = 0b00000001;
+
+// planes are written through a buffer of this many bytes
+const std::size_t WRITE_BUFFER_SIZE = 1 << 16;
+
+namespace
+{
+  void putLittleEndian(std::uint8_t* bytes, std::uint64_t value, std::size_t byte_count)
+  {
+    for (std::size_t byte_i = 0; byte_i < byte_count; byte_i++)
+    {
+      bytes[byte_i] = static_cast<std::uint8_t>(value >> (byte_i * 8));
+    }
+  }
+
+  std::uint64_t getLittleEndian(const std::uint8_t* bytes, std::size_t byte_count)
+  {
+    std::uint64_t value = 0;
+    for (std::size_t byte_i = 0; byte_i < byte_count; byte_i++)
+    {
+      value |= static_cast<std::uint64_t>(bytes[byte_i]) << (byte_i * 8);
+    }
+    return value;
+  }
+}  // namespace
+
+void fsweep::GameFile::Write(const fsweep::GameModel& game_model, std::ostream& stream)
+{
+  const auto game_configuration = game_model.GetGameConfiguration();
+  std::vector<std::uint8_t> header(fsweep::GameFile::HEADER_SIZE);
+  putLittleEndian(&header[0], fsweep::GameFile::MAGIC, 4);
+  putLittleEndian(&header[4], fsweep::GameFile::VERSION, 2);
+  header[6] = game_model.GetQuestionsEnabled() ? fsweep::GameFile::QUESTIONS_ENABLED_FLAG : 0;
+  header[7] = static_cast<std::uint8_t>(game_model.GetGameState());
+  putLittleEndian(&header[8], static_cast<std::uint32_t>(game_configuration.GetButtonsWide()), 4);
+  putLittleEndian(&header[12], static_cast<std::uint32_t>(game_configuration.GetButtonsTall()), 4);
+  putLittleEndian(&header[16], static_cast<std::uint32_t>(game_configuration.GetBombCount()), 4);
+  putLittleEndian(&header[24], game_model.GetSeed(), 8);
+  putLittleEndian(&header[32], game_model.GetGameTime(), 8);
+  stream.write(reinterpret_cast<const char*>(header.data()),
+               static_cast<std::streamsize>(header.size()));
+
+  const auto& buttons = game_model.GetButtons();
+  std::vector<std::uint8_t> buffer;
+  buffer.reserve(WRITE_BUFFER_SIZE);
+  const auto flush = [&]()
+  {
+    stream.write(reinterpret_cast<const char*>(buffer.data()),
+                 static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+  };
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i += 8)
+  {
+    std::uint8_t bomb_byte = 0;
+    for (std::size_t bit_i = 0; bit_i < 8 && button_i + bit_i < buttons.size(); bit_i++)
+    {
+      bomb_byte |= static_cast<std::uint8_t>(buttons[button_i + bit_i].GetHasBomb() << bit_i);
+    }
+    buffer.push_back(bomb_byte);
+    if (buffer.size() == WRITE_BUFFER_SIZE) flush();
+  }
+  flush();
+  for (std::size_t button_i = 0; button_i < buttons.size(); button_i += 4)
+  {
+    std::uint8_t state_byte = 0;
+    for (std::size_t bit_i = 0; bit_i < 4 && button_i + bit_i < buttons.size(); bit_i++)
+    {
+      state_byte |= static_cast<std::uint8_t>(
+          static_cast<std::uint8_t>(buttons[button_i + bit_i].GetButtonState()) << (bit_i * 2));
+    }
+    buffer.push_back(state_byte);
+    if (buffer.size() == WRITE_BUFFER_SIZE) flush();
+  }
+  flush();
+  if (!stream)
+  {
+    throw std::runtime_error("could not write game file");
+  }
+}
+
+void fsweep::GameFile::Write(const fsweep::GameModel& game_model, std::string_view path)
+{
+  std::ofstream stream(std::string(path), std::ios::binary);
+  if (!stream)
+  {
+    throw std::runtime_error("could not open game file");
+  }
+  fsweep::GameFile::Write(game_model, stream);
+}
+
+std::unique_ptr<fsweep::GameModel> fsweep::GameFile::Read(std::span<const std::uint8_t> data)
+{
+  if (data.size() < fsweep::GameFile::HEADER_SIZE ||
+      getLittleEndian(&data[0], 4) != fsweep::GameFile::MAGIC)
+  {
+    throw std::runtime_error("invalid game file");
+  }
+  if (getLittleEndian(&data[4], 2) > fsweep::GameFile::VERSION)
+  {
+    throw std::runtime_error("unsupported game file version");
+  }
+  const bool questions_enabled = (data[6] & fsweep::GameFile::QUESTIONS_ENABLED_FLAG) != 0;
+  if (data[7] > static_cast<std::uint8_t>(fsweep::GameState::Cool))
+  {
+    throw std::runtime_error("invalid game state");
+  }
+  const auto game_state = static_cast<fsweep::GameState>(data[7]);
+  const auto buttons_wide = static_cast<std::int32_t>(getLittleEndian(&data[8], 4));
+  const auto buttons_tall = static_cast<std::int32_t>(getLittleEndian(&data[12], 4));
+  const auto bomb_count = static_cast<std::int32_t>(getLittleEndian(&data[16], 4));
+  const fsweep::GameConfiguration game_configuration(buttons_wide, buttons_tall, bomb_count);
+  if (game_configuration.GetButtonsWide() != buttons_wide ||
+      game_configuration.GetButtonsTall() != buttons_tall ||
+      game_configuration.GetBombCount() != bomb_count)
+  {
+    throw std::runtime_error("invalid game configuration");
+  }
+  const auto seed = getLittleEndian(&data[24], 8);
+  const auto game_time = static_cast<unsigned long>(getLittleEndian(&data[32], 8));
+  const auto button_count = game_configuration.GetButtonCount();
+  const auto bomb_plane_size = fsweep::GameModel::GetBombPlaneSize(button_count);
+  const auto state_plane_size = fsweep::GameModel::GetStatePlaneSize(button_count);
+  if (data.size() != fsweep::GameFile::HEADER_SIZE + bomb_plane_size + state_plane_size)
+  {
+    throw std::runtime_error("invalid game file size");
+  }
+  auto game_model = std::make_unique<fsweep::GameModel>(
+      game_configuration, questions_enabled, game_state, game_time,
+      data.subspan(fsweep::GameFile::HEADER_SIZE, bomb_plane_size),
+      data.subspan(fsweep::GameFile::HEADER_SIZE + bomb_plane_size, state_plane_size));
+  game_model->SetSeed(seed);
+  return game_model;
+}
+
+std::unique_ptr<fsweep::GameModel> fsweep::GameFile::Read(std::string_view path)
+{
+  const fsweep::MappedFile mapped_file(path);
+  return fsweep::GameFile::Read(mapped_file.GetData());
+}
@@ -21,49 +21,431 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <exception>
+#include <fsweep/BombOracle.hpp>
 #include <fsweep/ButtonPosition.hpp>
+#include <fsweep/CounterRng.hpp>
 #include <fsweep/GameModel.hpp>
+#include <fsweep/PresetBoard.hpp>
 #include <fsweep/Timer.hpp>
+#include <fsweep/Trace.hpp>
+#include <random>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 fsweep::GameModel::GameModel(fsweep::GameConfiguration game_configuration, bool questions_enabled,
                              fsweep::GameState game_state, int game_time,
                              std::string_view button_string)
-    : game_configuration(game_configuration)
+    : buttons()
+    , game_configuration(game_configuration)
+    , game_state(game_state)
+    , questions_enabled(questions_enabled)
     , flag_count(0)
+    , buttons_left(static_cast<std::int64_t>(game_configuration.GetButtonCount()) -
+                   game_configuration.GetBombCount())
     , game_time(game_time)
-    , buttons_left(game_configuration.GetButtonCount() - game_configuration.GetBombCount())
-    , questions_enabled(questions_enabled)
-    , buttons()
-    , game_state(game_state)
 {
   if (button_string.length() != game_configuration.GetButtonCount())
   {
     throw std::runtime_error("invalid button string length");
   }
-  this->buttons.reserve(game_configuration.GetButtonCount());
-  for (std::size_t button_i = 0; button_i < game_configuration.GetButtonCount(); button_i++)
+  fsweep::GameModel::checkMemoryEstimate(game_configuration, false);
+  this->buttons.resize(game_configuration.GetButtonCount());
+  this->button_epochs.assign(game_configuration.GetButtonCount(), this->button_epoch);
+  fsweep::Button::FromChars(button_string, this->buttons);
+  this->flag_count = static_cast<int>(
+      fsweep::Button::CountButtonState(this->buttons, fsweep::ButtonState::Flagged));
+  this->buttons_left -= static_cast<std::int64_t>(
+      fsweep::Button::CountButtonState(this->buttons, fsweep::ButtonState::Down));
+  this->calculateSurroundingBombs();
+  this->board_hash = this->computeBoardHash();
+}
+
+fsweep::GameModel::GameModel(fsweep::GameConfiguration game_configuration, bool questions_enabled,
+                             fsweep::GameState game_state, unsigned long game_time,
+                             std::span<const std::uint8_t> bomb_plane,
+                             std::span<const std::uint8_t> state_plane)
+    : buttons()
+    , game_configuration(game_configuration)
+    , game_state(game_state)
+    , questions_enabled(questions_enabled)
+    , flag_count(0)
+    , buttons_left(static_cast<std::int64_t>(game_configuration.GetButtonCount()) -
+                   game_configuration.GetBombCount())
+    , game_time(game_time)
+{
+  const auto button_count = game_configuration.GetButtonCount();
+  if (bomb_plane.size() != fsweep::GameModel::GetBombPlaneSize(button_count) ||
+      state_plane.size() != fsweep::GameModel::GetStatePlaneSize(button_count))
   {
-    this->buttons.emplace_back(button_string[button_i]);
-    const auto& button = this->buttons.back();
-    if (button.GetButtonState() == fsweep::ButtonState::Flagged)
+    throw std::runtime_error("invalid button plane size");
+  }
+  fsweep::GameModel::checkMemoryEstimate(game_configuration, false);
+  this->buttons.resize(button_count);
+  this->button_epochs.assign(button_count, this->button_epoch);
+  for (std::size_t button_i = 0; button_i < button_count; button_i++)
+  {
+    const bool has_bomb = ((bomb_plane[button_i / 8] >> (button_i % 8)) & 1) != 0;
+    const auto button_state =
+        static_cast<fsweep::ButtonState>((state_plane[button_i / 4] >> ((button_i % 4) * 2)) & 3);
+    this->buttons[button_i] = fsweep::Button(button_state, has_bomb);
+    if (button_state == fsweep::ButtonState::Flagged)
     {
       this->flag_count++;
     }
-    if (button.GetButtonState() == fsweep::ButtonState::Down)
+    if (button_state == fsweep::ButtonState::Down)
     {
       this->buttons_left--;
     }
   }
   this->calculateSurroundingBombs();
+  this->board_hash = this->computeBoardHash();
+}
+
+// a copy has the board and the rng of the GameModel, but not its journal or its action listener
+fsweep::GameModel::GameModel(const fsweep::GameModel& game_model)
+    : buttons(game_model.buttons)
+    , button_epochs(game_model.button_epochs)
+    , button_epoch(game_model.button_epoch)
+    , game_configuration(game_model.game_configuration)
+    , game_state(game_model.game_state)
+    , questions_enabled(game_model.questions_enabled)
+    , lazy_counting(game_model.lazy_counting)
+    , flag_count(game_model.flag_count)
+    , buttons_left(game_model.buttons_left)
+    , game_time(game_model.game_time)
+    , board_hash(game_model.board_hash)
+    , game_number(game_model.game_number)
+    , frontier_tracking(game_model.frontier_tracking)
+    , covered_frontier(game_model.covered_frontier)
+    , number_frontier(game_model.number_frontier)
+    , seed(game_model.seed)
+    , rng_state(game_model.rng_state)
+    , placement_rng_state(game_model.placement_rng_state)
+    , thread_pool(game_model.thread_pool)
+{
+}
+
+fsweep::GameModel& fsweep::GameModel::operator=(const fsweep::GameModel& game_model)
+{
+  if (this != &game_model)
+  {
+    *this = fsweep::GameModel(game_model);
+  }
+  return *this;
+}
+
+fsweep::GameModel fsweep::GameModel::Clone() const { return fsweep::GameModel(*this); }
+
+fsweep::GameModel fsweep::GameModel::Fork(std::uint64_t fork_i) const
+{
+  auto fork = fsweep::GameModel(*this);
+  // every fork continues with its own stream, derived from the stream of this GameModel
+  fork.rng_state = fsweep::CounterRng::Get(this->rng_state, fork_i);
+  fork.seed = fork.rng_state;
+  return fork;
+}
+
+const std::uint64_t fsweep::GameModel::MAX_MEMORY_ESTIMATE = 4ULL * 1024 * 1024 * 1024;
+
+void fsweep::GameModel::checkMemoryEstimate(const fsweep::GameConfiguration& game_configuration,
+                                            bool frontier_tracking)
+{
+  const auto memory_estimate =
+      fsweep::GameModel::GetMemoryEstimate(game_configuration, frontier_tracking);
+  if (memory_estimate > fsweep::GameModel::MAX_MEMORY_ESTIMATE ||
+      game_configuration.GetButtonCount() > std::vector<fsweep::Button>().max_size())
+  {
+    throw std::runtime_error("game configuration needs too much memory");
+  }
+}
+
+const std::size_t fsweep::GameModel::PARALLEL_BUTTON_COUNT = 1 << 20;
+
+const std::size_t fsweep::GameModel::PARALLEL_FLOOD_FILL_COUNT = 1 << 16;
+
+// the rows of a board are split into stripes of about this many Buttons for a ThreadPool
+const int STRIPE_BUTTON_COUNT = 1 << 16;
+
+// the frontier of a parallel flood fill is split into tasks of this many Buttons
+const std::size_t FRONTIER_TASK_SIZE = 1 << 12;
+
+std::uint64_t fsweep::GameModel::getRandomSeed() noexcept
+{
+  try
+  {
+    std::random_device random_device;
+    return (static_cast<std::uint64_t>(random_device()) << 32) | random_device();
+  }
+  catch (const std::exception&)
+  {
+    // without an entropy source the clock is still random enough to pick a board
+    return static_cast<std::uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+}
+
+std::uint64_t fsweep::GameModel::getRandom() noexcept
+{
+  this->rng_state += fsweep::CounterRng::GOLDEN_GAMMA;
+  return fsweep::CounterRng::Mix(this->rng_state);
+}
+
+// the Zobrist keys are derived from this seed instead of being kept in a table per Button
+const std::uint64_t ZOBRIST_SEED = 0x5a6f627269737421ULL;
+
+namespace
+{
+  // a key for what is visible of a Button, a Button that is not pressed or marked has no key
+  std::uint64_t getZobristKey(std::size_t button_i, const fsweep::Button& button) noexcept
+  {
+    std::uint64_t visible_value = 0;
+    switch (button.GetButtonState())
+    {
+    case fsweep::ButtonState::None:
+      return 0;
+    case fsweep::ButtonState::Flagged:
+      visible_value = 1;
+      break;
+    case fsweep::ButtonState::Questioned:
+      visible_value = 2;
+      break;
+    case fsweep::ButtonState::Down:
+      visible_value = button.GetHasBomb() ? 3 : 4 + button.GetSurroundingBombs();
+      break;
+    }
+    return fsweep::CounterRng::Get(ZOBRIST_SEED, (static_cast<std::uint64_t>(button_i) << 4) |
+                                                     visible_value);
+  }
+}  // namespace
+
+std::uint64_t fsweep::GameModel::computeBoardHash() const noexcept
+{
+  std::uint64_t board_hash = 0;
+  for (std::size_t button_i = 0; button_i < this->buttons.size(); button_i++)
+  {
+    if (this->button_epochs[button_i] == this->button_epoch)
+    {
+      board_hash ^= getZobristKey(button_i, this->buttons[button_i]);
+    }
+  }
+  return board_hash;
+}
+
+fsweep::ThreadPool& fsweep::GameModel::getThreadPool()
+{
+  if (this->thread_pool == nullptr)
+  {
+    this->thread_pool = &fsweep::ThreadPool::GetInstance();
+  }
+  return *this->thread_pool;
+}
+
+int fsweep::GameModel::getStripeRows() const noexcept
+{
+  return std::max(STRIPE_BUTTON_COUNT / this->game_configuration.GetButtonsWide(), 1);
+}
+
+void fsweep::GameModel::clearButton(std::size_t button_i) noexcept
+{
+  auto& button = this->buttons[button_i];
+  if (this->button_epochs[button_i] != this->button_epoch)
+  {
+    button = fsweep::Button();
+    this->button_epochs[button_i] = this->button_epoch;
+    return;
+  }
+  button.SetHasBomb(false);
+  button.SetSurroundingBombs(0);
+  button.SetIsCounted(false);
+  button.Unpress();
+}
+
+void fsweep::GameModel::invalidateButtons() noexcept
+{
+  this->button_epoch++;
+  this->board_hash = 0;
+  this->covered_frontier.Clear();
+  this->number_frontier.Clear();
+  if (this->button_epoch == 0)
+  {
+    // the epoch wrapped around, so old epochs could match again
+    std::fill(this->buttons.begin(), this->buttons.end(), fsweep::Button());
+    std::fill(this->button_epochs.begin(), this->button_epochs.end(), this->button_epoch);
+  }
+}
+
+void fsweep::GameModel::syncButtons() const noexcept
+{
+  for (std::size_t button_i = 0; button_i < this->buttons.size(); button_i++)
+  {
+    if (this->button_epochs[button_i] != this->button_epoch)
+    {
+      this->buttons[button_i] = fsweep::Button();
+      this->button_epochs[button_i] = this->button_epoch;
+    }
+  }
+  if (!this->lazy_counting) return;
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  for (int y = 0; y < buttons_tall; y++)
+  {
+    for (int x = 0; x < buttons_wide; x++)
+    {
+      if (!this->buttons[fsweep::ButtonPosition(x, y).GetIndex(buttons_wide)].GetIsCounted())
+      {
+        this->countButton(x, y);
+      }
+    }
+  }
+}
+
+bool fsweep::GameModel::hasBomb(int x, int y) const noexcept
+{
+  const auto button_i =
+      fsweep::ButtonPosition(x, y).GetIndex(this->game_configuration.GetButtonsWide());
+  return this->button_epochs[button_i] == this->button_epoch &&
+         this->buttons[button_i].GetHasBomb();
+}
+
+void fsweep::GameModel::countButton(int x, int y) const noexcept
+{
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  int surrounding_bombs = 0;
+  for (int neighbour_y = std::max(y - 1, 0); neighbour_y <= std::min(y + 1, buttons_tall - 1);
+       neighbour_y++)
+  {
+    for (int neighbour_x = std::max(x - 1, 0); neighbour_x <= std::min(x + 1, buttons_wide - 1);
+         neighbour_x++)
+    {
+      if ((neighbour_x != x || neighbour_y != y) && this->hasBomb(neighbour_x, neighbour_y))
+      {
+        surrounding_bombs++;
+      }
+    }
+  }
+  auto& button = this->buttons[fsweep::ButtonPosition(x, y).GetIndex(buttons_wide)];
+  button.SetSurroundingBombs(surrounding_bombs);
+  button.SetIsCounted(true);
 }
 
 fsweep::Button& fsweep::GameModel::getButton(int x, int y)
 {
   const fsweep::ButtonPosition position(x, y);
-  return this->buttons[position.GetIndex(this->game_configuration.GetButtonsWide())];
+  const auto button_i = position.GetIndex(this->game_configuration.GetButtonsWide());
+  auto& button = this->buttons[button_i];
+  if (this->button_epochs[button_i] != this->button_epoch)
+  {
+    button = fsweep::Button();
+    this->button_epochs[button_i] = this->button_epoch;
+  }
+  if (this->lazy_counting && !button.GetIsCounted())
+  {
+    this->countButton(x, y);
+  }
+  return button;
+}
+
+void fsweep::GameModel::changeButton(int x, int y, fsweep::ButtonState button_state)
+{
+  auto& button = this->getButton(x, y);
+  const auto previous_button_state = button.GetButtonState();
+  if (previous_button_state == button_state) return;
+  const auto button_i =
+      fsweep::ButtonPosition(x, y).GetIndex(this->game_configuration.GetButtonsWide());
+  this->action_journal.AddChange(button_i, previous_button_state);
+  this->board_hash ^= getZobristKey(button_i, button);
+  button.SetButtonState(button_state);
+  this->board_hash ^= getZobristKey(button_i, button);
+  if (this->frontier_tracking && (previous_button_state == fsweep::ButtonState::Down) !=
+                                     (button_state == fsweep::ButtonState::Down))
+  {
+    this->updateFrontier(x, y);
+  }
+}
+
+namespace
+{
+  bool getIsRevealedNumber(const fsweep::Button& button) noexcept
+  {
+    return button.GetButtonState() == fsweep::ButtonState::Down && !button.GetHasBomb() &&
+           button.GetSurroundingBombs() > 0;
+  }
+}  // namespace
+
+void fsweep::GameModel::updateFrontierButton(int x, int y)
+{
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  const auto button_i = fsweep::ButtonPosition(x, y).GetIndex(buttons_wide);
+  const auto& button = this->getButton(x, y);
+  const bool is_down = button.GetButtonState() == fsweep::ButtonState::Down;
+  if (is_down && !getIsRevealedNumber(button))
+  {
+    this->covered_frontier.Erase(button_i);
+    this->number_frontier.Erase(button_i);
+    return;
+  }
+  // a revealed number needs a covered neighbour and a covered Button needs a number neighbour
+  bool has_neighbour = false;
+  for (int neighbour_y = std::max(y - 1, 0);
+       neighbour_y <= std::min(y + 1, buttons_tall - 1) && !has_neighbour; neighbour_y++)
+  {
+    for (int neighbour_x = std::max(x - 1, 0);
+         neighbour_x <= std::min(x + 1, buttons_wide - 1) && !has_neighbour; neighbour_x++)
+    {
+      if (neighbour_x == x && neighbour_y == y) continue;
+      const auto& neighbour_button = this->getButton(neighbour_x, neighbour_y);
+      has_neighbour = is_down ? neighbour_button.GetButtonState() != fsweep::ButtonState::Down
+                              : getIsRevealedNumber(neighbour_button);
+    }
+  }
+  auto& added_frontier = is_down ? this->number_frontier : this->covered_frontier;
+  auto& removed_frontier = is_down ? this->covered_frontier : this->number_frontier;
+  removed_frontier.Erase(button_i);
+  if (has_neighbour)
+  {
+    added_frontier.Insert(button_i);
+  }
+  else
+  {
+    added_frontier.Erase(button_i);
+  }
+}
+
+void fsweep::GameModel::updateFrontier(int x, int y)
+{
+  // only the Button and its neighbours have the Button as a neighbour
+  for (int neighbour_y = std::max(y - 1, 0);
+       neighbour_y <= std::min(y + 1, this->game_configuration.GetButtonsTall() - 1);
+       neighbour_y++)
+  {
+    for (int neighbour_x = std::max(x - 1, 0);
+         neighbour_x <= std::min(x + 1, this->game_configuration.GetButtonsWide() - 1);
+         neighbour_x++)
+    {
+      this->updateFrontierButton(neighbour_x, neighbour_y);
+    }
+  }
+}
+
+void fsweep::GameModel::beginAction(fsweep::GameAction game_action, int x, int y)
+{
+  const bool placing_bombs =
+      game_action == fsweep::GameAction::Click && this->game_state == fsweep::GameState::None;
+  this->action_journal.BeginAction({game_action, x, y, this->game_state, this->flag_count,
+                                    this->buttons_left, placing_bombs, 0});
+  if (placing_bombs && this->action_journal.GetIsRecording())
+  {
+    // undoing the first click puts the rng back so redoing it places the same bombs
+    this->placement_rng_state = this->rng_state;
+  }
 }
 
 void fsweep::GameModel::pressButton(int x, int y)
@@ -73,7 +455,7 @@ void fsweep::GameModel::pressButton(int x, int y)
   {
     if (button.GetHasBomb())
     {
-      button.Press();
+      this->changeButton(x, y, fsweep::ButtonState::Down);
       this->game_state = fsweep::GameState::Dead;
     }
     else
@@ -85,33 +467,135 @@ void fsweep::GameModel::pressButton(int x, int y)
 
 void fsweep::GameModel::floodFillClick(int x, int y)
 {
-  const fsweep::ButtonPosition start_position(x, y);
-  const auto buttons_wide = this->game_configuration.GetButtonsWide();
-  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  FSWEEP_TRACE_ZONE("GameModel::floodFillClick");
+  const bool can_fill_parallel =
+      !this->lazy_counting &&
+      this->game_configuration.GetButtonCount() >= fsweep::GameModel::PARALLEL_BUTTON_COUNT;
+  std::size_t pressed_count = 1;
+  // Buttons are pressed as they are pushed so each one is only pushed once
+  this->changeButton(x, y, fsweep::ButtonState::Down);
+  this->buttons_left--;
   this->flood_fill_stack.clear();
-  this->flood_fill_stack.push_back(start_position);
+  this->flood_fill_stack.push_back(fsweep::ButtonPosition(x, y));
   do
   {
+    if (can_fill_parallel && pressed_count >= fsweep::GameModel::PARALLEL_FLOOD_FILL_COUNT)
+    {
+      this->floodFillParallel();
+      break;
+    }
     const auto cur_position = this->flood_fill_stack.back();
     this->flood_fill_stack.pop_back();
-    auto& cur_button = this->getButton(cur_position.x, cur_position.y);
-    cur_button.Press();
-    this->buttons_left--;
-    if (cur_button.GetSurroundingBombs() == 0)
-    {
-      this->surroundingButtonAction(
-          cur_position,
-          [&](const fsweep::Button& button, const fsweep::ButtonPosition& position)
+    if (this->getButton(cur_position.x, cur_position.y).GetSurroundingBombs() != 0) continue;
+    this->surroundingButtonAction(
+        cur_position,
+        [&](const fsweep::Button& button, const fsweep::ButtonPosition& position)
+        {
+          if (button.GetIsPressable())
+          {
+            this->changeButton(position.x, position.y, fsweep::ButtonState::Down);
+            this->buttons_left--;
+            pressed_count++;
+            this->flood_fill_stack.push_back(position);
+          }
+        });
+  } while (!this->flood_fill_stack.empty());
+  FSWEEP_TRACE_COUNTER("buttons_left", this->buttons_left);
+}
+
+void fsweep::GameModel::floodFillParallel()
+{
+  FSWEEP_TRACE_ZONE("GameModel::floodFillParallel");
+  // the tasks read this->buttons without going through getButton, which is only valid because
+  // placeBombs has already brought every Button to the current epoch
+  assert(std::all_of(this->button_epochs.begin(), this->button_epochs.end(),
+                     [this](std::uint8_t epoch) { return epoch == this->button_epoch; }));
+  auto& thread_pool = this->getThreadPool();
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  std::vector<std::atomic<std::uint64_t>> claimed_bits((this->buttons.size() + 63) / 64);
+  // the frontier holds pressed Buttons whose neighbours still have to be checked
+  std::vector<fsweep::ButtonPosition> frontier;
+  frontier.swap(this->flood_fill_stack);
+  std::vector<std::vector<fsweep::ButtonPosition>> task_presses;
+  std::vector<std::uint64_t> task_hashes;
+  while (!frontier.empty())
+  {
+    const auto task_count = (frontier.size() + FRONTIER_TASK_SIZE - 1) / FRONTIER_TASK_SIZE;
+    task_presses.resize(task_count);
+    // Buttons are only read while claiming, and each neighbour is claimed by exactly one task
+    thread_pool.ParallelFor(
+        task_count,
+        [&](std::size_t task_i)
+        {
+          auto& presses = task_presses[task_i];
+          presses.clear();
+          const auto last_frontier_i = std::min((task_i + 1) * FRONTIER_TASK_SIZE, frontier.size());
+          for (auto frontier_i = task_i * FRONTIER_TASK_SIZE; frontier_i < last_frontier_i;
+               frontier_i++)
           {
-            if (button.GetIsPressable() &&
-                std::find(this->flood_fill_stack.begin(), this->flood_fill_stack.end(), position) ==
-                    this->flood_fill_stack.end())
+            const auto position = frontier[frontier_i];
+            if (this->buttons[position.GetIndex(buttons_wide)].GetSurroundingBombs() != 0)
+              continue;
+            for (int neighbour_y = std::max(position.y - 1, 0);
+                 neighbour_y <= std::min(position.y + 1, buttons_tall - 1); neighbour_y++)
             {
-              this->flood_fill_stack.push_back(position);
+              for (int neighbour_x = std::max(position.x - 1, 0);
+                   neighbour_x <= std::min(position.x + 1, buttons_wide - 1); neighbour_x++)
+              {
+                const fsweep::ButtonPosition neighbour_position(neighbour_x, neighbour_y);
+                const auto neighbour_i = neighbour_position.GetIndex(buttons_wide);
+                if (!this->buttons[neighbour_i].GetIsPressable()) continue;
+                const std::uint64_t claimed_bit = 1ULL << (neighbour_i % 64);
+                if ((claimed_bits[neighbour_i / 64].fetch_or(claimed_bit) & claimed_bit) != 0)
+                  continue;
+                presses.push_back(neighbour_position);
+              }
             }
-          });
+          }
+        });
+    if (this->action_journal.GetIsRecording())
+    {
+      for (const auto& presses : task_presses)
+      {
+        for (const auto& position : presses)
+        {
+          const auto button_i = position.GetIndex(buttons_wide);
+          this->action_journal.AddChange(button_i, this->buttons[button_i].GetButtonState());
+        }
+      }
     }
-  } while (!this->flood_fill_stack.empty());
+    task_hashes.assign(task_count, 0);
+    thread_pool.ParallelFor(task_count,
+                            [&](std::size_t task_i)
+                            {
+                              std::uint64_t task_hash = 0;
+                              for (const auto& position : task_presses[task_i])
+                              {
+                                const auto button_i = position.GetIndex(buttons_wide);
+                                auto& button = this->buttons[button_i];
+                                task_hash ^= getZobristKey(button_i, button);
+                                button.Press();
+                                task_hash ^= getZobristKey(button_i, button);
+                              }
+                              task_hashes[task_i] = task_hash;
+                            });
+    frontier.clear();
+    for (std::size_t task_i = 0; task_i < task_count; task_i++)
+    {
+      const auto& presses = task_presses[task_i];
+      this->board_hash ^= task_hashes[task_i];
+      if (this->frontier_tracking)
+      {
+        for (const auto& position : presses)
+        {
+          this->updateFrontier(position.x, position.y);
+        }
+      }
+      this->buttons_left -= static_cast<std::int64_t>(presses.size());
+      frontier.insert(frontier.end(), presses.begin(), presses.end());
+    }
+  }
 }
 
 bool fsweep::GameModel::choordingPossible(int x, int y)
@@ -119,6 +603,8 @@ bool fsweep::GameModel::choordingPossible(int x, int y)
   const auto& button = this->getButton(x, y);
   if (button.GetButtonState() != fsweep::ButtonState::Down) return false;
   auto surrounding_flags = 0;
+  // an area click with nothing left to press changes nothing
+  bool has_pressable = false;
   this->surroundingButtonAction(
       fsweep::ButtonPosition(x, y),
       [&](const fsweep::Button& button, const fsweep::ButtonPosition position)
@@ -127,8 +613,9 @@ bool fsweep::GameModel::choordingPossible(int x, int y)
         {
           surrounding_flags++;
         }
+        has_pressable = has_pressable || button.GetIsPressable();
       });
-  return surrounding_flags == button.GetSurroundingBombs();
+  return has_pressable && surrounding_flags == button.GetSurroundingBombs();
 }
 
 void fsweep::GameModel::surroundingButtonAction(
@@ -189,18 +676,23 @@ void fsweep::GameModel::surroundingButtonAction(
 
 void fsweep::GameModel::placeBombs(int initial_x, int initial_y)
 {
+  FSWEEP_TRACE_ZONE("GameModel::placeBombs");
+  if (this->game_configuration.GetButtonCount() >= fsweep::GameModel::PARALLEL_BUTTON_COUNT)
+  {
+    this->placeBombsParallel(initial_x, initial_y);
+    return;
+  }
   const auto bomb_count = this->game_configuration.GetBombCount();
-  for (auto& button : this->buttons)
+  for (std::size_t button_i = 0; button_i < this->buttons.size(); button_i++)
   {
-    button.SetHasBomb(false);
-    button.Unpress();
+    this->clearButton(button_i);
   }
   std::vector<bool> bombs(this->game_configuration.GetButtonCount());
   for (std::size_t button_i = 0; button_i < bomb_count; button_i++)
   {
     bombs[button_i] = true;
   }
-  if (bomb_count == this->buttons.size())
+  if (static_cast<std::size_t>(bomb_count) == this->buttons.size())
   {
     for (auto& cur_button : this->buttons)
     {
@@ -209,10 +701,11 @@ void fsweep::GameModel::placeBombs(int initial_x, int initial_y)
     return;
   }
   const auto last_minable_button_i = this->buttons.size() - 2;
-  std::uniform_int_distribution<std::mt19937::result_type> distributor(0, last_minable_button_i);
   for (std::size_t button_i = 0; button_i <= last_minable_button_i; button_i++)
   {
-    const std::size_t swap_i = static_cast<std::size_t>(distributor(this->rng));
+    // the modulo bias is negligible for a 64 bit random value and at most 2^32 Buttons
+    const std::size_t swap_i =
+        static_cast<std::size_t>(this->getRandom() % (last_minable_button_i + 1));
     // vector of bool are weird, std::swap doesn't work.
     bool temp = bombs[button_i];
     bombs[button_i] = bombs[swap_i];
@@ -234,8 +727,61 @@ void fsweep::GameModel::placeBombs(int initial_x, int initial_y)
   this->calculateSurroundingBombs();
 }
 
+void fsweep::GameModel::placeBombsParallel(int initial_x, int initial_y)
+{
+  FSWEEP_TRACE_ZONE("GameModel::placeBombsParallel");
+  // the bombs only depend on this seed, not on how the work is split between threads
+  const std::uint64_t board_seed = this->getRandom();
+  auto& thread_pool = this->getThreadPool();
+  const fsweep::BombOracle bomb_oracle(this->game_configuration, board_seed, initial_x, initial_y,
+                                       thread_pool);
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  const auto stripe_rows = this->getStripeRows();
+  const auto stripe_count =
+      static_cast<std::size_t>((buttons_tall + stripe_rows - 1) / stripe_rows);
+  thread_pool.ParallelFor(
+      stripe_count,
+      [&](std::size_t stripe_i)
+      {
+        const auto first_y = static_cast<int>(stripe_i) * stripe_rows;
+        const auto last_y = std::min(first_y + stripe_rows, buttons_tall);
+        for (int y = first_y; y < last_y; y++)
+        {
+          for (int x = 0; x < buttons_wide; x++)
+          {
+            const auto button_i = fsweep::ButtonPosition(x, y).GetIndex(buttons_wide);
+            this->clearButton(button_i);
+            this->buttons[button_i].SetHasBomb(bomb_oracle.HasBomb(x, y));
+          }
+        }
+      });
+  this->calculateSurroundingBombs();
+}
+
 void fsweep::GameModel::calculateSurroundingBombs()
 {
+  FSWEEP_TRACE_ZONE("GameModel::calculateSurroundingBombs");
+  if (this->lazy_counting) return;
+  switch (this->game_configuration.GetGameDifficulty())
+  {
+  case fsweep::GameDifficulty::Beginner:
+    fsweep::BeginnerBoard::CalculateSurroundingBombs(this->buttons.data());
+    return;
+  case fsweep::GameDifficulty::Intermediate:
+    fsweep::IntermediateBoard::CalculateSurroundingBombs(this->buttons.data());
+    return;
+  case fsweep::GameDifficulty::Expert:
+    fsweep::ExpertBoard::CalculateSurroundingBombs(this->buttons.data());
+    return;
+  default:
+    break;
+  }
+  if (this->game_configuration.GetButtonCount() >= fsweep::GameModel::PARALLEL_BUTTON_COUNT)
+  {
+    this->calculateSurroundingBombsParallel();
+    return;
+  }
   const auto buttons_wide = this->game_configuration.GetButtonsWide();
   const auto buttons_tall = this->game_configuration.GetButtonsTall();
   for (int x = 0; x < buttons_wide; x++)
@@ -257,6 +803,75 @@ void fsweep::GameModel::calculateSurroundingBombs()
   }
 }
 
+void fsweep::GameModel::calculateSurroundingBombsParallel()
+{
+  FSWEEP_TRACE_ZONE("GameModel::calculateSurroundingBombsParallel");
+  auto& thread_pool = this->getThreadPool();
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  const auto buttons_tall = this->game_configuration.GetButtonsTall();
+  const auto stripe_rows = this->getStripeRows();
+  const auto stripe_count =
+      static_cast<std::size_t>((buttons_tall + stripe_rows - 1) / stripe_rows);
+  const auto row_size = static_cast<std::size_t>(buttons_wide);
+  // a Button holds both its bomb and its count, so the rows around each stripe are copied before
+  // any stripe starts writing counts
+  std::vector<std::uint8_t> halo_bombs(stripe_count * 2 * row_size);
+  thread_pool.ParallelFor(
+      stripe_count,
+      [&](std::size_t stripe_i)
+      {
+        const auto first_y = static_cast<int>(stripe_i) * stripe_rows;
+        const auto last_y = std::min(first_y + stripe_rows, buttons_tall);
+        auto* halo_row = &halo_bombs[stripe_i * 2 * row_size];
+        for (const auto halo_y : {first_y - 1, last_y})
+        {
+          if (halo_y >= 0 && halo_y < buttons_tall)
+          {
+            for (int x = 0; x < buttons_wide; x++)
+            {
+              halo_row[x] = this->hasBomb(x, halo_y) ? 1 : 0;
+            }
+          }
+          halo_row += row_size;
+        }
+      });
+  thread_pool.ParallelFor(
+      stripe_count,
+      [&](std::size_t stripe_i)
+      {
+        const auto first_y = static_cast<int>(stripe_i) * stripe_rows;
+        const auto last_y = std::min(first_y + stripe_rows, buttons_tall);
+        const auto plane_wide = row_size + 2;
+        // the bombs of the stripe and its halo rows with an empty column on either side
+        std::vector<std::uint8_t> bomb_plane(plane_wide * (last_y - first_y + 2));
+        const auto* halo_row = &halo_bombs[stripe_i * 2 * row_size];
+        std::copy(halo_row, halo_row + row_size, bomb_plane.begin() + 1);
+        std::copy(halo_row + row_size, halo_row + (2 * row_size),
+                  bomb_plane.end() - static_cast<std::ptrdiff_t>(plane_wide) + 1);
+        for (int y = first_y; y < last_y; y++)
+        {
+          auto* plane_row = &bomb_plane[((y - first_y + 1) * plane_wide) + 1];
+          for (int x = 0; x < buttons_wide; x++)
+          {
+            plane_row[x] = this->hasBomb(x, y) ? 1 : 0;
+          }
+        }
+        for (int y = first_y; y < last_y; y++)
+        {
+          const auto* plane_row = &bomb_plane[((y - first_y + 1) * plane_wide) + 1];
+          for (int x = 0; x < buttons_wide; x++)
+          {
+            const auto* above = plane_row + x - plane_wide;
+            const auto* center = plane_row + x;
+            const auto* below = plane_row + x + plane_wide;
+            this->buttons[fsweep::ButtonPosition(x, y).GetIndex(buttons_wide)].SetSurroundingBombs(
+                above[-1] + above[0] + above[1] + center[-1] + center[1] + below[-1] + below[0] +
+                below[1]);
+          }
+        }
+      });
+}
+
 void fsweep::GameModel::tryWin() noexcept
 {
   if (this->buttons_left <= 0)
@@ -267,31 +882,41 @@ void fsweep::GameModel::tryWin() noexcept
 
 void fsweep::GameModel::NewGame()
 {
-  if (this->game_state != fsweep::GameState::None)
-  {
-    std::fill(this->buttons.begin(), this->buttons.end(), fsweep::Button());
-  }
+  FSWEEP_TRACE_ZONE("GameModel::NewGame");
+  this->game_number++;
+  this->invalidateButtons();
+  this->action_journal.Clear();
   this->game_time = 0;
   this->game_state = fsweep::GameState::None;
   this->flag_count = 0;
-  this->buttons_left =
-      this->game_configuration.GetButtonCount() - this->game_configuration.GetBombCount();
+  this->buttons_left = static_cast<std::int64_t>(this->game_configuration.GetButtonCount()) -
+                       this->game_configuration.GetBombCount();
 }
 
 void fsweep::GameModel::NewGame(fsweep::GameConfiguration game_configuration)
 {
+  FSWEEP_TRACE_ZONE("GameModel::NewGame(GameConfiguration)");
   if (this->game_configuration != game_configuration)
   {
+    fsweep::GameModel::checkMemoryEstimate(game_configuration, this->frontier_tracking);
     const std::size_t button_count = game_configuration.GetButtonCount();
     this->game_configuration = game_configuration;
-    this->buttons.clear();
+    this->game_number++;
+    this->invalidateButtons();
+    this->action_journal.Clear();
+    // resizing keeps the capacity, so switching back to a smaller board never reallocates
     this->buttons.resize(button_count);
-    this->flood_fill_stack.reserve(button_count);
+    this->button_epochs.resize(button_count, this->button_epoch);
+    if (this->frontier_tracking)
+    {
+      this->covered_frontier = fsweep::IndexedSet(button_count);
+      this->number_frontier = fsweep::IndexedSet(button_count);
+    }
     this->game_time = 0;
     this->game_state = fsweep::GameState::None;
     this->flag_count = 0;
-    this->buttons_left =
-        this->game_configuration.GetButtonCount() - this->game_configuration.GetBombCount();
+    this->buttons_left = static_cast<std::int64_t>(this->game_configuration.GetButtonCount()) -
+                         this->game_configuration.GetBombCount();
   }
   else
   {
@@ -301,42 +926,59 @@ void fsweep::GameModel::NewGame(fsweep::GameConfiguration game_configuration)
 
 void fsweep::GameModel::ClickButton(int x, int y)
 {
+  FSWEEP_TRACE_ZONE("GameModel::ClickButton");
   if (this->game_state != fsweep::GameState::Playing && this->game_state != fsweep::GameState::None)
     return;
-  const auto& button = this->getButton(x, y);
-  if (button.GetButtonState() == fsweep::ButtonState::Flagged) return;
+  // a flagged or revealed Button does not change, so it is neither reported nor journaled
+  if (!this->getButton(x, y).GetIsPressable()) return;
+  if (this->action_listener) this->action_listener(fsweep::GameAction::Click, x, y);
+  this->beginAction(fsweep::GameAction::Click, x, y);
   if (this->game_state == fsweep::GameState::None)
   {
     this->placeBombs(x, y);
     this->game_state = fsweep::GameState::Playing;
   }
   this->pressButton(x, y);
-  if (this->game_configuration.GetBombCount() == this->game_configuration.GetButtonCount())
+  if (static_cast<std::size_t>(this->game_configuration.GetBombCount()) ==
+      this->game_configuration.GetButtonCount())
   {
     this->game_state = fsweep::GameState::Dead;
   }
   this->tryWin();
+  this->action_journal.EndAction();
 }
 
 void fsweep::GameModel::AltClickButton(int x, int y)
 {
+  FSWEEP_TRACE_ZONE("GameModel::AltClickButton");
   if (this->game_state == fsweep::GameState::Dead || this->game_state == fsweep::GameState::Cool) return;
-  auto& button = this->getButton(x, y);
-  if (button.GetButtonState() == fsweep::ButtonState::Flagged)
+  auto alt_pressed_button = this->getButton(x, y);
+  const auto button_state = alt_pressed_button.GetButtonState();
+  alt_pressed_button.AltPress(this->questions_enabled);
+  // a revealed Button does not change, and journaling it would make the next undo do nothing
+  if (alt_pressed_button.GetButtonState() == button_state) return;
+  if (this->action_listener) this->action_listener(fsweep::GameAction::AltClick, x, y);
+  this->beginAction(fsweep::GameAction::AltClick, x, y);
+  if (button_state == fsweep::ButtonState::Flagged)
   {
     this->flag_count--;
   }
-  button.AltPress(this->questions_enabled);
-  if (button.GetButtonState() == fsweep::ButtonState::Flagged)
+  if (alt_pressed_button.GetButtonState() == fsweep::ButtonState::Flagged)
   {
     this->flag_count++;
   }
+  this->changeButton(x, y, alt_pressed_button.GetButtonState());
+  this->action_journal.EndAction();
+  FSWEEP_TRACE_COUNTER("flag_count", this->flag_count);
 }
 
 void fsweep::GameModel::AreaClickButton(int x, int y)
 {
+  FSWEEP_TRACE_ZONE("GameModel::AreaClickButton");
   if (this->game_state == fsweep::GameState::Dead || this->game_state == fsweep::GameState::Cool) return;
   if (!this->choordingPossible(x, y)) return;
+  if (this->action_listener) this->action_listener(fsweep::GameAction::AreaClick, x, y);
+  this->beginAction(fsweep::GameAction::AreaClick, x, y);
   const auto buttons_wide = this->game_configuration.GetButtonsWide();
   const auto buttons_tall = this->game_configuration.GetButtonsTall();
   const fsweep::ButtonPosition center_position(x, y);
@@ -355,15 +997,105 @@ void fsweep::GameModel::AreaClickButton(int x, int y)
         }
       });
   this->tryWin();
+  this->action_journal.EndAction();
+}
+
+void fsweep::GameModel::SetJournalCapacity(std::size_t action_capacity,
+                                           std::size_t change_capacity)
+{
+  this->action_journal = fsweep::ActionJournal(action_capacity, change_capacity);
+}
+
+bool fsweep::GameModel::Undo()
+{
+  if (!this->GetCanUndo()) return false;
+  const auto action = this->action_journal.GetUndoAction();
+  std::size_t button_i = 0;
+  fsweep::ButtonState button_state = fsweep::ButtonState::None;
+  while (this->action_journal.PopChange(button_i, button_state))
+  {
+    auto& button = this->buttons[button_i];
+    const bool was_down = button.GetButtonState() == fsweep::ButtonState::Down;
+    this->board_hash ^= getZobristKey(button_i, button);
+    button.SetButtonState(button_state);
+    this->board_hash ^= getZobristKey(button_i, button);
+    if (this->frontier_tracking && was_down != (button_state == fsweep::ButtonState::Down))
+    {
+      const auto buttons_wide = static_cast<std::size_t>(this->game_configuration.GetButtonsWide());
+      this->updateFrontier(static_cast<int>(button_i % buttons_wide),
+                           static_cast<int>(button_i / buttons_wide));
+    }
+  }
+  if (action.placed_bombs)
+  {
+    for (button_i = 0; button_i < this->buttons.size(); button_i++)
+    {
+      if (this->button_epochs[button_i] != this->button_epoch) continue;
+      auto& button = this->buttons[button_i];
+      button.SetHasBomb(false);
+      button.SetSurroundingBombs(0);
+      button.SetIsCounted(false);
+    }
+    this->rng_state = this->placement_rng_state;
+  }
+  this->game_state = action.game_state;
+  this->flag_count = action.flag_count;
+  this->buttons_left = action.buttons_left;
+  this->action_journal.PopAction();
+  return true;
+}
+
+bool fsweep::GameModel::Redo()
+{
+  if (!this->GetCanRedo()) return false;
+  const auto action = this->action_journal.GetRedoAction();
+  // the action is applied again, which records it again in place of the undone one
+  this->action_journal.BeginRedo();
+  switch (action.game_action)
+  {
+  case fsweep::GameAction::Click:
+    this->ClickButton(action.x, action.y);
+    break;
+  case fsweep::GameAction::AltClick:
+    this->AltClickButton(action.x, action.y);
+    break;
+  case fsweep::GameAction::AreaClick:
+    this->AreaClickButton(action.x, action.y);
+    break;
+  }
+  return true;
+}
+
+std::uint64_t fsweep::GameModel::GetBoardHash() const noexcept { return this->board_hash; }
+
+std::uint64_t fsweep::GameModel::GetGameNumber() const noexcept { return this->game_number; }
+
+// a replay has no undo events, so a game that is recorded can not be undone without diverging
+bool fsweep::GameModel::GetCanUndo() const noexcept
+{
+  return !this->action_listener && this->action_journal.GetCanUndo();
+}
+
+bool fsweep::GameModel::GetCanRedo() const noexcept
+{
+  return !this->action_listener && this->action_journal.GetCanRedo();
 }
 
 void fsweep::GameModel::SetQuestionsEnabled(bool questions_enabled)
 {
   if (this->questions_enabled == questions_enabled) return;
+  // the journal could otherwise bring back questions or redo alt clicks differently
+  this->action_journal.Clear();
   if (!questions_enabled)
   {
-    for (auto& button : this->buttons)
+    for (std::size_t button_i = 0; button_i < this->buttons.size(); button_i++)
     {
+      auto& button = this->buttons[button_i];
+      if (button.GetButtonState() != fsweep::ButtonState::Questioned) continue;
+      if (this->button_epochs[button_i] == this->button_epoch)
+      {
+        this->board_hash ^= getZobristKey(button_i, button);
+      }
       button.RemoveQuestion();
     }
   }
@@ -372,6 +1104,72 @@ void fsweep::GameModel::SetQuestionsEnabled(bool questions_enabled)
 
 bool fsweep::GameModel::GetQuestionsEnabled() const noexcept { return this->questions_enabled; }
 
+void fsweep::GameModel::SetLazyCounting(bool lazy_counting)
+{
+  if (this->lazy_counting == lazy_counting) return;
+  // every Button needs its count before counting lazily can be turned off
+  this->syncButtons();
+  this->lazy_counting = lazy_counting;
+}
+
+bool fsweep::GameModel::GetLazyCounting() const noexcept { return this->lazy_counting; }
+
+void fsweep::GameModel::SetFrontierTracking(bool frontier_tracking)
+{
+  if (this->frontier_tracking == frontier_tracking) return;
+  if (frontier_tracking)
+  {
+    fsweep::GameModel::checkMemoryEstimate(this->game_configuration, true);
+  }
+  this->frontier_tracking = frontier_tracking;
+  if (!frontier_tracking)
+  {
+    this->covered_frontier = fsweep::IndexedSet();
+    this->number_frontier = fsweep::IndexedSet();
+    return;
+  }
+  this->covered_frontier = fsweep::IndexedSet(this->buttons.size());
+  this->number_frontier = fsweep::IndexedSet(this->buttons.size());
+  for (int y = 0; y < this->game_configuration.GetButtonsTall(); y++)
+  {
+    for (int x = 0; x < this->game_configuration.GetButtonsWide(); x++)
+    {
+      this->updateFrontierButton(x, y);
+    }
+  }
+}
+
+bool fsweep::GameModel::GetFrontierTracking() const noexcept { return this->frontier_tracking; }
+
+std::span<const std::uint32_t> fsweep::GameModel::GetCoveredFrontier() const noexcept
+{
+  return this->covered_frontier.GetValues();
+}
+
+std::span<const std::uint32_t> fsweep::GameModel::GetNumberFrontier() const noexcept
+{
+  return this->number_frontier.GetValues();
+}
+
+void fsweep::GameModel::SetSeed(std::uint64_t seed)
+{
+  this->seed = seed;
+  this->rng_state = seed;
+}
+
+std::uint64_t fsweep::GameModel::GetSeed() const noexcept { return this->seed; }
+
+void fsweep::GameModel::SetThreadPool(fsweep::ThreadPool& thread_pool) noexcept
+{
+  this->thread_pool = &thread_pool;
+}
+
+void fsweep::GameModel::SetActionListener(
+    std::function<void(fsweep::GameAction, int, int)> action_listener)
+{
+  this->action_listener = std::move(action_listener);
+}
+
 int fsweep::GameModel::GetFlagCount() const noexcept { return this->flag_count; }
 
 int fsweep::GameModel::GetBombsLeft() const noexcept
@@ -379,7 +1177,7 @@ int fsweep::GameModel::GetBombsLeft() const noexcept
   return this->game_configuration.GetBombCount() - this->flag_count;
 }
 
-int fsweep::GameModel::GetButtonsLeft() const noexcept { return this->buttons_left; }
+std::int64_t fsweep::GameModel::GetButtonsLeft() const noexcept { return this->buttons_left; }
 
 fsweep::GameState fsweep::GameModel::GetGameState() const noexcept { return this->game_state; }
 
@@ -407,11 +1205,78 @@ unsigned long fsweep::GameModel::GetTimerSeconds() const noexcept
 
 const fsweep::Button& fsweep::GameModel::GetButton(int x, int y) const
 {
+  static const fsweep::Button DEFAULT_BUTTON = fsweep::Button();
   const fsweep::ButtonPosition position(x, y);
-  return this->buttons.at(position.GetIndex(this->game_configuration.GetButtonsWide()));
+  const auto button_i = position.GetIndex(this->game_configuration.GetButtonsWide());
+  const auto& button = this->buttons.at(button_i);
+  if (this->button_epochs[button_i] != this->button_epoch) return DEFAULT_BUTTON;
+  if (this->lazy_counting && !button.GetIsCounted())
+  {
+    this->countButton(x, y);
+  }
+  return button;
+}
+
+std::string fsweep::GameModel::ToButtonString() const
+{
+  this->syncButtons();
+  std::string button_string(this->buttons.size(), '.');
+  fsweep::Button::ToChars(this->buttons, button_string);
+  return button_string;
+}
+
+std::vector<std::uint8_t> fsweep::GameModel::ToBombPlane() const
+{
+  this->syncButtons();
+  std::vector<std::uint8_t> bomb_plane(fsweep::GameModel::GetBombPlaneSize(this->buttons.size()));
+  for (std::size_t button_i = 0; button_i < this->buttons.size(); button_i++)
+  {
+    bomb_plane[button_i / 8] |=
+        static_cast<std::uint8_t>(this->buttons[button_i].GetHasBomb() << (button_i % 8));
+  }
+  return bomb_plane;
+}
+
+std::vector<std::uint8_t> fsweep::GameModel::ToStatePlane() const
+{
+  this->syncButtons();
+  std::vector<std::uint8_t> state_plane(
+      fsweep::GameModel::GetStatePlaneSize(this->buttons.size()));
+  for (std::size_t button_i = 0; button_i < this->buttons.size(); button_i++)
+  {
+    state_plane[button_i / 4] |= static_cast<std::uint8_t>(
+        static_cast<std::uint8_t>(this->buttons[button_i].GetButtonState())
+        << ((button_i % 4) * 2));
+  }
+  return state_plane;
 }
 
 const std::vector<fsweep::Button>& fsweep::GameModel::GetButtons() const noexcept
 {
+  this->syncButtons();
   return this->buttons;
-}
\ No newline at end of file
+}
+
+std::uint64_t fsweep::GameModel::GetMemoryEstimate(
+    const fsweep::GameConfiguration& game_configuration, bool frontier_tracking) noexcept
+{
+  const auto button_count = static_cast<std::uint64_t>(game_configuration.GetButtonsWide()) *
+                            static_cast<std::uint64_t>(game_configuration.GetButtonsTall());
+  // a Button and its epoch, plus the bits used while placing bombs and in a parallel flood fill
+  auto memory_estimate =
+      (button_count * (sizeof(fsweep::Button) + sizeof(std::uint8_t))) + (button_count / 4) + 2;
+  // both frontiers keep a position for every Button, and since one holds covered Buttons and the
+  // other revealed ones, their values add up to at most one per Button
+  if (frontier_tracking) memory_estimate += button_count * (3 * sizeof(std::uint32_t));
+  return memory_estimate;
+}
+
+std::size_t fsweep::GameModel::GetBombPlaneSize(std::size_t button_count) noexcept
+{
+  return (button_count + 7) / 8;
+}
+
+std::size_t fsweep::GameModel::GetStatePlaneSize(std::size_t button_count) noexcept
+{
+  return (button_count + 3) / 4;
+}
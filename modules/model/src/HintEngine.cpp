@@ -0,0 +1,606 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/Button.hpp>
+#include <fsweep/ButtonState.hpp>
+#include <fsweep/FrontierSolver.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/GameState.hpp>
+#include <fsweep/Hint.hpp>
+#include <fsweep/HintEngine.hpp>
+#include <fsweep/LatencyHistogram.hpp>
+#include <fsweep/RiskLayer.hpp>
+#include <fsweep/RiskSampler.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+const std::int8_t UNKNOWN_MARK = 0;
+const std::int8_t SAFE_MARK = 1;
+const std::int8_t BOMB_MARK = 2;
+
+namespace
+{
+  // a revealed number and the covered Buttons around it, which hide exactly bomb_count bombs
+  struct HintConstraint
+  {
+    std::size_t button_i;
+    std::array<std::size_t, 8> button_is;
+    int button_count;
+    int bomb_count;
+  };
+
+  HintConstraint getHintConstraint(const fsweep::GameModel& game_model, std::size_t button_i)
+  {
+    const auto game_configuration = game_model.GetGameConfiguration();
+    const auto buttons_wide = game_configuration.GetButtonsWide();
+    const auto buttons_tall = game_configuration.GetButtonsTall();
+    const auto x = static_cast<int>(button_i % buttons_wide);
+    const auto y = static_cast<int>(button_i / buttons_wide);
+    HintConstraint hint_constraint{button_i, {}, 0,
+                                   game_model.GetButton(x, y).GetSurroundingBombs()};
+    for (int y_offset = -1; y_offset <= 1; y_offset++)
+    {
+      for (int x_offset = -1; x_offset <= 1; x_offset++)
+      {
+        const int cur_x = x + x_offset;
+        const int cur_y = y + y_offset;
+        if ((x_offset == 0 && y_offset == 0) || cur_x < 0 || cur_x >= buttons_wide || cur_y < 0 ||
+            cur_y >= buttons_tall)
+        {
+          continue;
+        }
+        if (game_model.GetButton(cur_x, cur_y).GetButtonState() != fsweep::ButtonState::Down)
+        {
+          hint_constraint.button_is[hint_constraint.button_count++] =
+              static_cast<std::size_t>(cur_y) * buttons_wide + cur_x;
+        }
+      }
+    }
+    return hint_constraint;
+  }
+
+  std::int8_t getHintMark(const std::unordered_map<std::size_t, std::int8_t>& marks,
+                          std::size_t button_i)
+  {
+    const auto mark_it = marks.find(button_i);
+    return mark_it == marks.end() ? UNKNOWN_MARK : mark_it->second;
+  }
+
+  // collects the Buttons of a constraint that are not marked yet and returns the bombs among them
+  int reduceHintConstraint(const HintConstraint& hint_constraint,
+                           const std::unordered_map<std::size_t, std::int8_t>& marks,
+                           std::array<std::size_t, 8>& unknown_is, int& unknown_count)
+  {
+    int bomb_count = hint_constraint.bomb_count;
+    unknown_count = 0;
+    for (int button_i = 0; button_i < hint_constraint.button_count; button_i++)
+    {
+      const auto mark = getHintMark(marks, hint_constraint.button_is[button_i]);
+      if (mark == BOMB_MARK)
+      {
+        bomb_count--;
+      }
+      else if (mark == UNKNOWN_MARK)
+      {
+        unknown_is[unknown_count++] = hint_constraint.button_is[button_i];
+      }
+    }
+    return bomb_count;
+  }
+
+  // marks Buttons that single constraints decide, then Buttons that a constraint decides once the
+  // Buttons of a neighbouring constraint within it are taken out
+  void markHintButtons(const std::vector<HintConstraint>& hint_constraints, int buttons_wide,
+                       int buttons_tall, std::unordered_map<std::size_t, std::int8_t>& marks)
+  {
+    std::unordered_map<std::size_t, std::size_t> constraint_is;
+    for (std::size_t constraint_i = 0; constraint_i < hint_constraints.size(); constraint_i++)
+    {
+      constraint_is[hint_constraints[constraint_i].button_i] = constraint_i;
+    }
+    std::array<std::size_t, 8> unknown_is;
+    std::array<std::size_t, 8> other_unknown_is;
+    int unknown_count = 0;
+    int other_unknown_count = 0;
+    bool changed = true;
+    while (changed)
+    {
+      changed = false;
+      for (const auto& hint_constraint : hint_constraints)
+      {
+        const auto bomb_count =
+            reduceHintConstraint(hint_constraint, marks, unknown_is, unknown_count);
+        if (unknown_count == 0 || (bomb_count != 0 && bomb_count != unknown_count)) continue;
+        for (int unknown_i = 0; unknown_i < unknown_count; unknown_i++)
+        {
+          marks[unknown_is[unknown_i]] = bomb_count == 0 ? SAFE_MARK : BOMB_MARK;
+        }
+        changed = true;
+      }
+      if (changed) continue;
+      for (const auto& hint_constraint : hint_constraints)
+      {
+        const auto bomb_count =
+            reduceHintConstraint(hint_constraint, marks, unknown_is, unknown_count);
+        if (unknown_count == 0) continue;
+        const auto x = static_cast<int>(hint_constraint.button_i % buttons_wide);
+        const auto y = static_cast<int>(hint_constraint.button_i / buttons_wide);
+        for (int other_y = std::max(y - 2, 0); other_y <= std::min(y + 2, buttons_tall - 1);
+             other_y++)
+        {
+          for (int other_x = std::max(x - 2, 0); other_x <= std::min(x + 2, buttons_wide - 1);
+               other_x++)
+          {
+            const auto other_it =
+                constraint_is.find(static_cast<std::size_t>(other_y) * buttons_wide + other_x);
+            if (other_it == constraint_is.end()) continue;
+            const auto other_bomb_count = reduceHintConstraint(
+                hint_constraints[other_it->second], marks, other_unknown_is, other_unknown_count);
+            if (other_unknown_count <= unknown_count) continue;
+            const auto other_end = other_unknown_is.begin() + other_unknown_count;
+            const bool is_subset = std::all_of(
+                unknown_is.begin(), unknown_is.begin() + unknown_count, [&](std::size_t button_i)
+                { return std::find(other_unknown_is.begin(), other_end, button_i) != other_end; });
+            if (!is_subset) continue;
+            const auto rest_count = other_unknown_count - unknown_count;
+            const auto rest_bomb_count = other_bomb_count - bomb_count;
+            if (rest_bomb_count != 0 && rest_bomb_count != rest_count) continue;
+            for (int other_i = 0; other_i < other_unknown_count; other_i++)
+            {
+              const auto button_i = other_unknown_is[other_i];
+              if (std::find(unknown_is.begin(), unknown_is.begin() + unknown_count, button_i) ==
+                  unknown_is.begin() + unknown_count)
+              {
+                marks[button_i] = rest_bomb_count == 0 ? SAFE_MARK : BOMB_MARK;
+              }
+            }
+            changed = true;
+          }
+        }
+      }
+    }
+  }
+
+  // marks the Buttons that only the constraints taken together decide, then what the rules find
+  // from those until the FrontierSolver finds nothing new
+  void solveHintButtons(const std::vector<HintConstraint>& hint_constraints, int buttons_wide,
+                        int buttons_tall, std::unordered_map<std::size_t, std::int8_t>& marks)
+  {
+    fsweep::FrontierSolver frontier_solver;
+    std::array<std::size_t, 8> unknown_is;
+    int unknown_count = 0;
+    while (true)
+    {
+      frontier_solver.Clear();
+      for (const auto& hint_constraint : hint_constraints)
+      {
+        const auto bomb_count =
+            reduceHintConstraint(hint_constraint, marks, unknown_is, unknown_count);
+        frontier_solver.AddConstraint(
+            std::span<const std::size_t>(unknown_is.data(), unknown_count), bomb_count);
+      }
+      frontier_solver.Solve();
+      if (frontier_solver.GetSafeButtons().empty() && frontier_solver.GetBombButtons().empty())
+      {
+        return;
+      }
+      for (const auto button_i : frontier_solver.GetSafeButtons())
+      {
+        marks[button_i] = SAFE_MARK;
+      }
+      for (const auto button_i : frontier_solver.GetBombButtons())
+      {
+        marks[button_i] = BOMB_MARK;
+      }
+      markHintButtons(hint_constraints, buttons_wide, buttons_tall, marks);
+    }
+  }
+
+  // what the constraints of a board tell about its covered Buttons
+  struct HintAnalysis
+  {
+    std::vector<HintConstraint> hint_constraints;
+    std::unordered_map<std::size_t, std::int8_t> marks;
+    // each frontier Button is given the highest local bomb density around it and every other
+    // covered Button shares the bombs the frontier is not expected to hold
+    std::unordered_map<std::size_t, double> frontier_risks;
+    std::int64_t interior_count;
+    double interior_risk;
+  };
+
+  // with a RiskSampler the frontier risks are sampled instead whenever they are needed, which is
+  // when nothing is known to be safe or when every risk is wanted
+  void analyzeHintBoard(const fsweep::GameModel& game_model, HintAnalysis& hint_analysis,
+                        fsweep::RiskSampler* risk_sampler, bool needs_risks)
+  {
+    if (game_model.GetGameState() != fsweep::GameState::Playing) return;
+    const auto game_configuration = game_model.GetGameConfiguration();
+    const auto buttons_wide = game_configuration.GetButtonsWide();
+    const auto buttons_tall = game_configuration.GetButtonsTall();
+    auto& hint_constraints = hint_analysis.hint_constraints;
+    if (game_model.GetFrontierTracking())
+    {
+      for (const auto button_i : game_model.GetNumberFrontier())
+      {
+        hint_constraints.push_back(getHintConstraint(game_model, button_i));
+      }
+    }
+    else
+    {
+      for (std::size_t button_i = 0; button_i < game_configuration.GetButtonCount(); button_i++)
+      {
+        const auto& button = game_model.GetButton(static_cast<int>(button_i % buttons_wide),
+                                                  static_cast<int>(button_i / buttons_wide));
+        if (button.GetButtonState() != fsweep::ButtonState::Down ||
+            button.GetSurroundingBombs() == 0)
+        {
+          continue;
+        }
+        const auto hint_constraint = getHintConstraint(game_model, button_i);
+        if (hint_constraint.button_count != 0) hint_constraints.push_back(hint_constraint);
+      }
+    }
+    markHintButtons(hint_constraints, buttons_wide, buttons_tall, hint_analysis.marks);
+    solveHintButtons(hint_constraints, buttons_wide, buttons_tall, hint_analysis.marks);
+    int marked_bomb_count = 0;
+    for (const auto& [button_i, mark] : hint_analysis.marks)
+    {
+      if (mark == BOMB_MARK) marked_bomb_count++;
+    }
+    std::array<std::size_t, 8> unknown_is;
+    int unknown_count = 0;
+    for (const auto& hint_constraint : hint_constraints)
+    {
+      const auto bomb_count =
+          reduceHintConstraint(hint_constraint, hint_analysis.marks, unknown_is, unknown_count);
+      for (int unknown_i = 0; unknown_i < unknown_count; unknown_i++)
+      {
+        auto& risk = hint_analysis.frontier_risks[unknown_is[unknown_i]];
+        risk = std::max(risk, static_cast<double>(bomb_count) / unknown_count);
+      }
+    }
+    double expected_bomb_count = 0.0;
+    for (const auto& [button_i, risk] : hint_analysis.frontier_risks)
+    {
+      expected_bomb_count += risk;
+    }
+    const auto bombs_left = game_configuration.GetBombCount() - marked_bomb_count;
+    const auto covered_count = game_model.GetButtonsLeft() + game_configuration.GetBombCount();
+    hint_analysis.interior_count = covered_count -
+                                   static_cast<std::int64_t>(hint_analysis.marks.size()) -
+                                   static_cast<std::int64_t>(hint_analysis.frontier_risks.size());
+    hint_analysis.interior_risk =
+        hint_analysis.interior_count <= 0
+            ? 1.0
+            : std::clamp((bombs_left - expected_bomb_count) /
+                             static_cast<double>(hint_analysis.interior_count),
+                         0.0, 1.0);
+
+    const bool has_safe_mark =
+        std::any_of(hint_analysis.marks.begin(), hint_analysis.marks.end(),
+                    [](const auto& mark) { return mark.second == SAFE_MARK; });
+    if (risk_sampler == nullptr || hint_analysis.frontier_risks.empty() ||
+        (has_safe_mark && !needs_risks))
+    {
+      return;
+    }
+    risk_sampler->Clear();
+    for (const auto& hint_constraint : hint_constraints)
+    {
+      const auto bomb_count =
+          reduceHintConstraint(hint_constraint, hint_analysis.marks, unknown_is, unknown_count);
+      risk_sampler->AddConstraint(std::span<const std::size_t>(unknown_is.data(), unknown_count),
+                                  bomb_count);
+    }
+    risk_sampler->Sample(std::max(hint_analysis.interior_count, std::int64_t(0)), bombs_left,
+                         game_model.GetBoardHash());
+    const auto sample_count = risk_sampler->GetSampleCount();
+    if (sample_count == 0) return;
+    // a Button no sample put a bomb in is still not known to be safe
+    const auto least_risk = 1.0 / static_cast<double>(sample_count + 2);
+    const auto button_is = risk_sampler->GetButtons();
+    const auto risks = risk_sampler->GetRisks();
+    for (std::size_t column_i = 0; column_i < button_is.size(); column_i++)
+    {
+      hint_analysis.frontier_risks[button_is[column_i]] =
+          std::clamp(static_cast<double>(risks[column_i]), least_risk, 1.0 - least_risk);
+    }
+    if (hint_analysis.interior_count > 0)
+    {
+      hint_analysis.interior_risk = risk_sampler->GetInteriorRisk();
+    }
+  }
+
+  std::optional<fsweep::Hint> getAnalyzedHint(const fsweep::GameModel& game_model,
+                                              const HintAnalysis& hint_analysis)
+  {
+    const auto game_configuration = game_model.GetGameConfiguration();
+    const auto buttons_wide = game_configuration.GetButtonsWide();
+    const auto buttons_tall = game_configuration.GetButtonsTall();
+    const auto game_number = game_model.GetGameNumber();
+    const auto board_hash = game_model.GetBoardHash();
+    // the first click never hits a bomb
+    if (game_model.GetGameState() == fsweep::GameState::Default)
+    {
+      return fsweep::Hint(buttons_wide / 2, buttons_tall / 2, 0.0, game_number, board_hash);
+    }
+    if (game_model.GetGameState() != fsweep::GameState::Playing) return std::nullopt;
+    const auto get_hint = [&](std::size_t button_i, double risk)
+    {
+      return fsweep::Hint(static_cast<int>(button_i % buttons_wide),
+                          static_cast<int>(button_i / buttons_wide), risk, game_number,
+                          board_hash);
+    };
+    std::optional<std::size_t> safe_i;
+    for (const auto& [button_i, mark] : hint_analysis.marks)
+    {
+      if (mark == SAFE_MARK && (!safe_i || button_i < *safe_i)) safe_i = button_i;
+    }
+    if (safe_i) return get_hint(*safe_i, 0.0);
+    std::optional<std::size_t> guess_i;
+    double guess_risk = 1.0;
+    for (const auto& [button_i, risk] : hint_analysis.frontier_risks)
+    {
+      const auto& button = game_model.GetButton(static_cast<int>(button_i % buttons_wide),
+                                                static_cast<int>(button_i / buttons_wide));
+      if (button.GetButtonState() == fsweep::ButtonState::Flagged) continue;
+      if (!guess_i || risk < guess_risk || (risk == guess_risk && button_i < *guess_i))
+      {
+        guess_i = button_i;
+        guess_risk = risk;
+      }
+    }
+    if (hint_analysis.interior_count > 0 && (!guess_i || hint_analysis.interior_risk < guess_risk))
+    {
+      const auto& buttons = game_model.GetButtons();
+      for (std::size_t button_i = 0; button_i < buttons.size(); button_i++)
+      {
+        const auto& button = game_model.GetButton(static_cast<int>(button_i % buttons_wide),
+                                                  static_cast<int>(button_i / buttons_wide));
+        if ((button.GetButtonState() == fsweep::ButtonState::None ||
+             button.GetButtonState() == fsweep::ButtonState::Questioned) &&
+            !hint_analysis.marks.contains(button_i) &&
+            !hint_analysis.frontier_risks.contains(button_i))
+        {
+          return get_hint(button_i, hint_analysis.interior_risk);
+        }
+      }
+    }
+    if (!guess_i) return std::nullopt;
+    return get_hint(*guess_i, guess_risk);
+  }
+
+  std::vector<float> getAnalyzedRisks(const fsweep::GameModel& game_model,
+                                      const HintAnalysis& hint_analysis)
+  {
+    const auto game_configuration = game_model.GetGameConfiguration();
+    const auto buttons_wide = game_configuration.GetButtonsWide();
+    const auto button_count = game_configuration.GetButtonCount();
+    std::vector<float> risks(button_count, fsweep::RiskLayer::NO_RISK);
+    const auto game_state = game_model.GetGameState();
+    if (game_state == fsweep::GameState::Default)
+    {
+      risks.assign(button_count, static_cast<float>(game_configuration.GetBombCount()) /
+                                     static_cast<float>(button_count));
+      return risks;
+    }
+    if (game_state != fsweep::GameState::Playing) return risks;
+    for (std::size_t button_i = 0; button_i < button_count; button_i++)
+    {
+      const auto& button = game_model.GetButton(static_cast<int>(button_i % buttons_wide),
+                                                static_cast<int>(button_i / buttons_wide));
+      if (button.GetButtonState() == fsweep::ButtonState::Down) continue;
+      risks[button_i] = static_cast<float>(hint_analysis.interior_risk);
+    }
+    for (const auto& [button_i, risk] : hint_analysis.frontier_risks)
+    {
+      risks[button_i] = static_cast<float>(risk);
+    }
+    for (const auto& [button_i, mark] : hint_analysis.marks)
+    {
+      risks[button_i] = mark == BOMB_MARK ? 1.0f : 0.0f;
+    }
+    return risks;
+  }
+}  // namespace
+
+// the sampler shares the cores with the interface and whatever else the game is doing
+fsweep::HintEngine::HintEngine()
+    : thread_pool(std::max(std::thread::hardware_concurrency() / 2, 1u)),
+      risk_sampler(this->thread_pool)
+{
+  this->thread = std::thread(&fsweep::HintEngine::threadLoop, this);
+}
+
+fsweep::HintEngine::~HintEngine()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stopping = true;
+  }
+  this->request_condition.notify_all();
+  this->thread.join();
+}
+
+void fsweep::HintEngine::threadLoop()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  std::vector<std::size_t> changed_is;
+  while (true)
+  {
+    this->request_condition.wait(
+        lock, [this]() { return this->stopping || this->request_model != nullptr; });
+    if (this->stopping) return;
+    const auto game_model = std::move(this->request_model);
+    const auto request_time = this->request_time;
+    const auto risk_tracking = this->risk_tracking;
+    const auto risk_generation = this->risk_generation;
+    lock.unlock();
+    HintAnalysis hint_analysis;
+    analyzeHintBoard(*game_model, hint_analysis, &this->risk_sampler, risk_tracking);
+    auto hint = getAnalyzedHint(*game_model, hint_analysis);
+    const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - request_time);
+    const auto latency_us = static_cast<std::uint64_t>(latency.count());
+    if (hint) hint->latency_us = latency_us;
+    bool risk_reset = false;
+    changed_is.clear();
+    if (risk_tracking)
+    {
+      if (this->risk_layer_generation != risk_generation)
+      {
+        this->risk_layer.Clear();
+        this->risk_layer_generation = risk_generation;
+      }
+      risk_reset =
+          this->risk_layer.Update(getAnalyzedRisks(*game_model, hint_analysis), changed_is);
+    }
+    lock.lock();
+    this->hint = hint;
+    this->latency_histogram.Record(latency_us);
+    if (risk_tracking && risk_generation == this->risk_generation)
+    {
+      if (risk_reset) this->risk_changes.clear();
+      for (const auto button_i : changed_is)
+      {
+        this->risk_changes[button_i] = this->risk_layer.GetLevel(button_i);
+      }
+      this->risk_game_number = game_model->GetGameNumber();
+      this->risk_board_hash = game_model->GetBoardHash();
+    }
+    const auto hint_listener = this->hint_listener;
+    lock.unlock();
+    if (hint_listener) hint_listener();
+    lock.lock();
+  }
+}
+
+std::optional<fsweep::Hint> fsweep::HintEngine::Analyze(const fsweep::GameModel& game_model,
+                                                        fsweep::RiskSampler* risk_sampler)
+{
+  HintAnalysis hint_analysis;
+  analyzeHintBoard(game_model, hint_analysis, risk_sampler, false);
+  return getAnalyzedHint(game_model, hint_analysis);
+}
+
+std::vector<float> fsweep::HintEngine::AnalyzeRisks(const fsweep::GameModel& game_model,
+                                                    fsweep::RiskSampler* risk_sampler)
+{
+  HintAnalysis hint_analysis;
+  analyzeHintBoard(game_model, hint_analysis, risk_sampler, true);
+  return getAnalyzedRisks(game_model, hint_analysis);
+}
+
+void fsweep::HintEngine::SetHintListener(std::function<void()> hint_listener)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->hint_listener = std::move(hint_listener);
+}
+
+bool fsweep::HintEngine::Request(const fsweep::GameModel& game_model)
+{
+  const auto game_number = game_model.GetGameNumber();
+  const auto board_hash = game_model.GetBoardHash();
+  const auto game_state = game_model.GetGameState();
+  if (this->has_requested && this->requested_game_number == game_number &&
+      this->requested_board_hash == board_hash && this->requested_game_state == game_state)
+  {
+    return false;
+  }
+  const auto request_time = std::chrono::steady_clock::now();
+  this->has_requested = true;
+  this->requested_game_number = game_number;
+  this->requested_board_hash = board_hash;
+  this->requested_game_state = game_state;
+  auto request_model = std::make_unique<fsweep::GameModel>(game_model.Clone());
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->request_model = std::move(request_model);
+    this->request_time = request_time;
+  }
+  this->request_condition.notify_one();
+  return true;
+}
+
+std::optional<fsweep::Hint> fsweep::HintEngine::GetHint(const fsweep::GameModel& game_model)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  if (!this->hint || this->hint->game_number != game_model.GetGameNumber() ||
+      this->hint->board_hash != game_model.GetBoardHash())
+  {
+    return std::nullopt;
+  }
+  return this->hint;
+}
+
+fsweep::LatencyHistogram fsweep::HintEngine::GetLatencyHistogram()
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->latency_histogram;
+}
+
+void fsweep::HintEngine::SetRiskTracking(bool risk_tracking)
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (this->risk_tracking == risk_tracking) return;
+    this->risk_tracking = risk_tracking;
+    this->risk_generation++;
+    this->risk_changes.clear();
+  }
+  // the current board has to be analysed again for its risks
+  this->has_requested = false;
+}
+
+bool fsweep::HintEngine::GetRiskTracking()
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  return this->risk_tracking;
+}
+
+// hands out the levels changed since the last call, but only once they describe the given board
+bool fsweep::HintEngine::TakeRiskChanges(
+    const fsweep::GameModel& game_model,
+    std::vector<std::pair<std::size_t, std::uint8_t>>& risk_changes)
+{
+  std::lock_guard<std::mutex> lock(this->mutex);
+  if (this->risk_changes.empty() || this->risk_game_number != game_model.GetGameNumber() ||
+      this->risk_board_hash != game_model.GetBoardHash())
+  {
+    return false;
+  }
+  risk_changes.assign(this->risk_changes.begin(), this->risk_changes.end());
+  this->risk_changes.clear();
+  return true;
+}
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fsweep/IndexedSet.hpp>
+#include <limits>
+#include <stdexcept>
+
+const std::uint32_t fsweep::IndexedSet::NO_POSITION = std::numeric_limits<std::uint32_t>::max();
+
+fsweep::IndexedSet::IndexedSet(std::size_t index_count)
+{
+  // the largest index is kept free to mark an index that is not in the set
+  if (index_count > fsweep::IndexedSet::NO_POSITION)
+  {
+    throw std::runtime_error("too many indices for an indexed set");
+  }
+  this->positions.assign(index_count, fsweep::IndexedSet::NO_POSITION);
+}
+
+void fsweep::IndexedSet::Insert(std::size_t index)
+{
+  if (this->positions[index] != fsweep::IndexedSet::NO_POSITION) return;
+  this->positions[index] = static_cast<std::uint32_t>(this->values.size());
+  this->values.push_back(static_cast<std::uint32_t>(index));
+}
+
+void fsweep::IndexedSet::Erase(std::size_t index) noexcept
+{
+  const auto position = this->positions[index];
+  if (position == fsweep::IndexedSet::NO_POSITION) return;
+  // the last value takes the place of the erased one
+  const auto last_value = this->values.back();
+  this->values[position] = last_value;
+  this->positions[last_value] = position;
+  this->values.pop_back();
+  this->positions[index] = fsweep::IndexedSet::NO_POSITION;
+}
+
+void fsweep::IndexedSet::Clear() noexcept
+{
+  for (const auto value : this->values)
+  {
+    this->positions[value] = fsweep::IndexedSet::NO_POSITION;
+  }
+  this->values.clear();
+}
+
+bool fsweep::IndexedSet::GetContains(std::size_t index) const noexcept
+{
+  return this->positions[index] != fsweep::IndexedSet::NO_POSITION;
+}
+
+std::size_t fsweep::IndexedSet::GetSize() const noexcept { return this->values.size(); }
+
+std::span<const std::uint32_t> fsweep::IndexedSet::GetValues() const noexcept
+{
+  return this->values;
+}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/LatencyHistogram.hpp>
+
+const int fsweep::LatencyHistogram::SUB_BUCKET_BITS = 7;
+const std::size_t fsweep::LatencyHistogram::SUB_BUCKET_COUNT = std::size_t(1)
+                                                                << SUB_BUCKET_BITS;
+const std::size_t fsweep::LatencyHistogram::BUCKET_COUNT =
+    (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+std::size_t fsweep::LatencyHistogram::GetBucketIndex(std::uint64_t value) noexcept
+{
+  // values below two sub bucket spans are stored exactly, larger values keep SUB_BUCKET_BITS
+  // significant bits so the relative error stays below 1 / SUB_BUCKET_COUNT
+  if (value < 2 * SUB_BUCKET_COUNT) return static_cast<std::size_t>(value);
+  const int magnitude = std::bit_width(value) - 1;
+  const int shift = magnitude - SUB_BUCKET_BITS;
+  return static_cast<std::size_t>(shift + 1) * SUB_BUCKET_COUNT +
+         static_cast<std::size_t>((value >> shift) - SUB_BUCKET_COUNT);
+}
+
+std::uint64_t fsweep::LatencyHistogram::GetBucketLowestValue(std::size_t bucket_i) noexcept
+{
+  if (bucket_i < 2 * SUB_BUCKET_COUNT) return bucket_i;
+  const auto shift = (bucket_i / SUB_BUCKET_COUNT) - 1;
+  const auto sub_bucket = (bucket_i % SUB_BUCKET_COUNT) + SUB_BUCKET_COUNT;
+  return static_cast<std::uint64_t>(sub_bucket) << shift;
+}
+
+std::uint64_t fsweep::LatencyHistogram::GetBucketHighestValue(std::size_t bucket_i) noexcept
+{
+  if (bucket_i < 2 * SUB_BUCKET_COUNT) return bucket_i;
+  const auto shift = (bucket_i / SUB_BUCKET_COUNT) - 1;
+  return GetBucketLowestValue(bucket_i) + ((std::uint64_t(1) << shift) - 1);
+}
+
+void fsweep::LatencyHistogram::Record(std::uint64_t value) noexcept
+{
+  this->counts[GetBucketIndex(value)]++;
+  this->total_count++;
+  this->min_value = std::min(this->min_value, value);
+  this->max_value = std::max(this->max_value, value);
+  this->value_sum += value;
+}
+
+void fsweep::LatencyHistogram::Merge(const fsweep::LatencyHistogram& other) noexcept
+{
+  for (std::size_t bucket_i = 0; bucket_i < BUCKET_COUNT; bucket_i++)
+  {
+    this->counts[bucket_i] += other.counts[bucket_i];
+  }
+  this->total_count += other.total_count;
+  this->min_value = std::min(this->min_value, other.min_value);
+  this->max_value = std::max(this->max_value, other.max_value);
+  this->value_sum += other.value_sum;
+}
+
+void fsweep::LatencyHistogram::Reset() noexcept
+{
+  std::fill(this->counts.begin(), this->counts.end(), 0);
+  this->total_count = 0;
+  this->min_value = UINT64_MAX;
+  this->max_value = 0;
+  this->value_sum = 0.0;
+}
+
+std::uint64_t fsweep::LatencyHistogram::GetCount() const noexcept { return this->total_count; }
+
+std::uint64_t fsweep::LatencyHistogram::GetMin() const noexcept
+{
+  return this->total_count == 0 ? 0 : this->min_value;
+}
+
+std::uint64_t fsweep::LatencyHistogram::GetMax() const noexcept { return this->max_value; }
+
+double fsweep::LatencyHistogram::GetMean() const noexcept
+{
+  if (this->total_count == 0) return 0.0;
+  return static_cast<double>(this->value_sum / this->total_count);
+}
+
+std::uint64_t fsweep::LatencyHistogram::GetValueAtPercentile(double percentile) const noexcept
+{
+  if (this->total_count == 0) return 0;
+  const double clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+  const auto target_count = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(
+             std::ceil((clamped_percentile / 100.0) * static_cast<double>(this->total_count))));
+  std::uint64_t running_count = 0;
+  for (std::size_t bucket_i = 0; bucket_i < BUCKET_COUNT; bucket_i++)
+  {
+    running_count += this->counts[bucket_i];
+    if (running_count >= target_count)
+    {
+      return std::min(GetBucketHighestValue(bucket_i), this->max_value);
+    }
+  }
+  return this->max_value;
+}
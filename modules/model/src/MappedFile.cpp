@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *model
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fsweep/MappedFile.hpp>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+fsweep::MappedFile::MappedFile(std::string_view path)
+{
+  this->file_handle = CreateFileA(std::string(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (this->file_handle == INVALID_HANDLE_VALUE)
+  {
+    this->file_handle = nullptr;
+    throw std::runtime_error("could not open file");
+  }
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(this->file_handle, &file_size))
+  {
+    this->close();
+    throw std::runtime_error("could not read file size");
+  }
+  this->size = static_cast<std::size_t>(file_size.QuadPart);
+  if (this->size == 0) return;
+  this->mapping_handle =
+      CreateFileMappingA(this->file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (this->mapping_handle == nullptr)
+  {
+    this->close();
+    throw std::runtime_error("could not map file");
+  }
+  this->data = static_cast<const std::uint8_t*>(
+      MapViewOfFile(this->mapping_handle, FILE_MAP_READ, 0, 0, 0));
+  if (this->data == nullptr)
+  {
+    this->close();
+    throw std::runtime_error("could not map file");
+  }
+}
+
+void fsweep::MappedFile::close() noexcept
+{
+  if (this->data != nullptr) UnmapViewOfFile(this->data);
+  if (this->mapping_handle != nullptr) CloseHandle(this->mapping_handle);
+  if (this->file_handle != nullptr) CloseHandle(this->file_handle);
+  this->data = nullptr;
+  this->mapping_handle = nullptr;
+  this->file_handle = nullptr;
+  this->size = 0;
+}
+
+#else
+
+fsweep::MappedFile::MappedFile(std::string_view path)
+{
+  const int file_descriptor = open(std::string(path).c_str(), O_RDONLY);
+  if (file_descriptor < 0)
+  {
+    throw std::runtime_error("could not open file");
+  }
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) != 0)
+  {
+    ::close(file_descriptor);
+    throw std::runtime_error("could not read file size");
+  }
+  this->size = static_cast<std::size_t>(file_status.st_size);
+  if (this->size != 0)
+  {
+    void* mapping = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+      ::close(file_descriptor);
+      throw std::runtime_error("could not map file");
+    }
+    // the planes are read front to back once
+    madvise(mapping, this->size, MADV_SEQUENTIAL);
+    this->data = static_cast<const std::uint8_t*>(mapping);
+  }
+  // the mapping stays valid after the file is closed
+  ::close(file_descriptor);
+}
+
+void fsweep::MappedFile::close() noexcept
+{
+  if (this->data != nullptr)
+  {
+    munmap(const_cast<std::uint8_t*>(this->data), this->size);
+  }
+  this->data = nullptr;
+  this->size = 0;
+}
+
+#endif
+
+fsweep::MappedFile::~MappedFile() { this->close(); }
+
+std::span<const std::uint8_t> fsweep::MappedFile::GetData() const noexcept
+{
+  return std::span<const std::uint8_t>(this->data, this->size);
+}
@@ -0,0 +1,529 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/ButtonState.hpp>
+#include <fsweep/CounterRng.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/GameState.hpp>
+#include <fsweep/OptimalSolver.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+const std::size_t fsweep::OptimalSolver::MAX_BUTTON_COUNT = 64;
+const std::uint64_t fsweep::OptimalSolver::MAX_ARRANGEMENT_COUNT = 1 << 20;
+const std::size_t fsweep::OptimalSolver::SHARD_COUNT = 64;
+
+const std::uint8_t NO_OPTIMAL_BUTTON = 0xff;
+const std::uint64_t COVERED_NIBBLE = 0xf;
+const std::size_t NIBBLES_PER_WORD = 16;
+
+namespace
+{
+  // the number of ways to choose count of button_count Buttons, or limit + 1 if there are more
+  std::uint64_t countOptimalArrangements(std::uint64_t button_count, std::uint64_t count,
+                                         std::uint64_t limit)
+  {
+    if (count > button_count) return 0;
+    std::uint64_t arrangement_count = 1;
+    for (std::uint64_t i = 1; i <= count; i++)
+    {
+      arrangement_count = arrangement_count * (button_count - count + i) / i;
+      if (arrangement_count > limit) return limit + 1;
+    }
+    return arrangement_count;
+  }
+
+  std::uint64_t getOptimalNibble(const std::array<std::uint64_t, 4>& state_key,
+                                 std::size_t button_i)
+  {
+    return (state_key[button_i / NIBBLES_PER_WORD] >> (4 * (button_i % NIBBLES_PER_WORD))) & 0xf;
+  }
+
+  void setOptimalNibble(std::array<std::uint64_t, 4>& state_key, std::size_t button_i,
+                        std::uint64_t nibble)
+  {
+    state_key[button_i / NIBBLES_PER_WORD] |= nibble << (4 * (button_i % NIBBLES_PER_WORD));
+  }
+
+  // calls on_mask with every mask of count bits among the Buttons in button_is
+  void forEachOptimalCombination(const std::vector<std::size_t>& button_is, std::size_t count,
+                                 const std::function<void(std::uint64_t)>& on_mask)
+  {
+    if (count > button_is.size()) return;
+    std::vector<std::size_t> picks(count);
+    for (std::size_t pick_i = 0; pick_i < count; pick_i++)
+    {
+      picks[pick_i] = pick_i;
+    }
+    while (true)
+    {
+      std::uint64_t mask = 0;
+      for (const auto pick : picks)
+      {
+        mask |= std::uint64_t(1) << button_is[pick];
+      }
+      on_mask(mask);
+      auto pick_i = count;
+      while (pick_i > 0 && picks[pick_i - 1] == button_is.size() - count + pick_i - 1)
+      {
+        pick_i--;
+      }
+      if (pick_i == 0) return;
+      picks[pick_i - 1]++;
+      for (auto next_i = pick_i; next_i < count; next_i++)
+      {
+        picks[next_i] = picks[next_i - 1] + 1;
+      }
+    }
+  }
+}  // namespace
+
+std::size_t fsweep::OptimalSolver::StateKeyHash::operator()(
+    const StateKey& state_key) const noexcept
+{
+  std::uint64_t hash = 0;
+  for (const auto word : state_key)
+  {
+    hash = fsweep::CounterRng::Mix(hash ^ word) + fsweep::CounterRng::GOLDEN_GAMMA;
+  }
+  return static_cast<std::size_t>(hash);
+}
+
+fsweep::OptimalSolver::OptimalSolver(const fsweep::GameConfiguration& game_configuration)
+    : game_configuration(game_configuration), shards(fsweep::OptimalSolver::SHARD_COUNT)
+{
+  this->button_count = game_configuration.GetButtonCount();
+  this->bomb_count = static_cast<std::size_t>(game_configuration.GetBombCount());
+  if (this->button_count > fsweep::OptimalSolver::MAX_BUTTON_COUNT)
+  {
+    throw std::runtime_error("board too large to solve");
+  }
+  this->first_arrangement_count =
+      countOptimalArrangements(this->button_count - 1, this->bomb_count,
+                               fsweep::OptimalSolver::MAX_ARRANGEMENT_COUNT);
+  if (this->first_arrangement_count > fsweep::OptimalSolver::MAX_ARRANGEMENT_COUNT)
+  {
+    throw std::runtime_error("too many bomb arrangements to solve");
+  }
+  this->all_mask = this->button_count == 64 ? ~std::uint64_t(0)
+                                            : (std::uint64_t(1) << this->button_count) - 1;
+  const auto buttons_wide = game_configuration.GetButtonsWide();
+  const auto buttons_tall = game_configuration.GetButtonsTall();
+  for (int y = 0; y < buttons_tall; y++)
+  {
+    for (int x = 0; x < buttons_wide; x++)
+    {
+      std::uint64_t neighbour_mask = 0;
+      for (int near_y = std::max(y - 1, 0); near_y <= std::min(y + 1, buttons_tall - 1); near_y++)
+      {
+        for (int near_x = std::max(x - 1, 0); near_x <= std::min(x + 1, buttons_wide - 1);
+             near_x++)
+        {
+          if (near_x != x || near_y != y)
+          {
+            neighbour_mask |= std::uint64_t(1) << (near_y * buttons_wide + near_x);
+          }
+        }
+      }
+      this->neighbour_masks.push_back(neighbour_mask);
+    }
+  }
+  // mirror images, and turns of a square board, lead to the same chances
+  const bool is_square = buttons_wide == buttons_tall;
+  for (int symmetry = 0; symmetry < (is_square ? 8 : 4); symmetry++)
+  {
+    std::vector<std::uint8_t> symmetry_map;
+    for (int y = 0; y < buttons_tall; y++)
+    {
+      for (int x = 0; x < buttons_wide; x++)
+      {
+        auto symmetric_x = (symmetry & 1) != 0 ? buttons_wide - 1 - x : x;
+        auto symmetric_y = (symmetry & 2) != 0 ? buttons_tall - 1 - y : y;
+        if ((symmetry & 4) != 0) std::swap(symmetric_x, symmetric_y);
+        symmetry_map.push_back(static_cast<std::uint8_t>(symmetric_y * buttons_wide + symmetric_x));
+      }
+    }
+    bool is_new = true;
+    for (std::size_t symmetry_i = 0; symmetry_i < this->symmetry_count; symmetry_i++)
+    {
+      is_new = is_new && !std::equal(symmetry_map.begin(), symmetry_map.end(),
+                                     this->symmetry_maps.begin() + symmetry_i * this->button_count);
+    }
+    if (!is_new) continue;
+    std::vector<std::uint8_t> inverse_map(this->button_count);
+    for (std::size_t button_i = 0; button_i < this->button_count; button_i++)
+    {
+      inverse_map[symmetry_map[button_i]] = static_cast<std::uint8_t>(button_i);
+    }
+    this->symmetry_maps.insert(this->symmetry_maps.end(), symmetry_map.begin(),
+                               symmetry_map.end());
+    this->inverse_maps.insert(this->inverse_maps.end(), inverse_map.begin(), inverse_map.end());
+    this->symmetry_count++;
+  }
+  this->first_win_counts.assign(this->button_count, 0);
+}
+
+fsweep::OptimalSolver::Arrangement fsweep::OptimalSolver::getArrangement(
+    std::uint64_t bomb_mask) const noexcept
+{
+  std::uint64_t zero_mask = 0;
+  for (std::size_t button_i = 0; button_i < this->button_count; button_i++)
+  {
+    if ((this->neighbour_masks[button_i] & bomb_mask) == 0)
+    {
+      zero_mask |= std::uint64_t(1) << button_i;
+    }
+  }
+  return {bomb_mask, zero_mask & ~bomb_mask};
+}
+
+// packs the number of every revealed Button and a marker for every covered one in four bits
+fsweep::OptimalSolver::StateKey fsweep::OptimalSolver::getStateKey(
+    std::uint64_t revealed_mask, std::uint64_t bomb_mask) const noexcept
+{
+  StateKey state_key = {};
+  for (std::size_t button_i = 0; button_i < this->button_count; button_i++)
+  {
+    const std::uint64_t nibble =
+        (revealed_mask >> button_i) & 1
+            ? static_cast<std::uint64_t>(std::popcount(this->neighbour_masks[button_i] & bomb_mask))
+            : COVERED_NIBBLE;
+    setOptimalNibble(state_key, button_i, nibble);
+  }
+  return state_key;
+}
+
+std::pair<fsweep::OptimalSolver::StateKey, std::size_t> fsweep::OptimalSolver::getCanonicalKey(
+    const StateKey& state_key) const noexcept
+{
+  auto canonical_key = state_key;
+  std::size_t canonical_i = 0;
+  for (std::size_t symmetry_i = 1; symmetry_i < this->symmetry_count; symmetry_i++)
+  {
+    const auto symmetry_map = this->symmetry_maps.data() + symmetry_i * this->button_count;
+    StateKey symmetric_key = {};
+    for (std::size_t button_i = 0; button_i < this->button_count; button_i++)
+    {
+      setOptimalNibble(symmetric_key, symmetry_map[button_i],
+                       getOptimalNibble(state_key, button_i));
+    }
+    if (symmetric_key < canonical_key)
+    {
+      canonical_key = symmetric_key;
+      canonical_i = symmetry_i;
+    }
+  }
+  return {canonical_key, canonical_i};
+}
+
+// entries are kept for the canonical board, so their Button is mapped on the way in and out
+std::optional<fsweep::OptimalSolver::StateEntry> fsweep::OptimalSolver::findState(
+    const StateKey& state_key)
+{
+  const auto [canonical_key, symmetry_i] = this->getCanonicalKey(state_key);
+  auto& shard = this->shards[StateKeyHash()(canonical_key) % fsweep::OptimalSolver::SHARD_COUNT];
+  std::unique_lock<std::mutex> lock(shard.mutex);
+  const auto entry_it = shard.state_entries.find(canonical_key);
+  if (entry_it == shard.state_entries.end()) return std::nullopt;
+  auto state_entry = entry_it->second;
+  lock.unlock();
+  if (state_entry.button_i != NO_OPTIMAL_BUTTON)
+  {
+    state_entry.button_i =
+        this->inverse_maps[symmetry_i * this->button_count + state_entry.button_i];
+  }
+  return state_entry;
+}
+
+void fsweep::OptimalSolver::storeState(const StateKey& state_key, StateEntry state_entry)
+{
+  const auto [canonical_key, symmetry_i] = this->getCanonicalKey(state_key);
+  if (state_entry.button_i != NO_OPTIMAL_BUTTON)
+  {
+    state_entry.button_i =
+        this->symmetry_maps[symmetry_i * this->button_count + state_entry.button_i];
+  }
+  auto& shard = this->shards[StateKeyHash()(canonical_key) % fsweep::OptimalSolver::SHARD_COUNT];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.state_entries.emplace(canonical_key, state_entry);
+}
+
+// the most arrangements any sequence of moves wins from a visible board, where a board that is
+// already decided is not worth keeping
+fsweep::OptimalSolver::StateEntry fsweep::OptimalSolver::solveState(
+    const StateKey& state_key, std::uint64_t revealed_mask,
+    const std::vector<Arrangement>& arrangements)
+{
+  const auto arrangement_count = static_cast<std::uint32_t>(arrangements.size());
+  StateEntry state_entry = {0, arrangement_count, NO_OPTIMAL_BUTTON};
+  const auto covered_mask = this->all_mask & ~revealed_mask;
+  if (static_cast<std::size_t>(std::popcount(covered_mask)) == this->bomb_count)
+  {
+    state_entry.win_count = arrangement_count;
+    return state_entry;
+  }
+  if (arrangement_count == 1)
+  {
+    // every covered Button is known, so clicking the safe ones wins
+    state_entry.win_count = 1;
+    state_entry.button_i = static_cast<std::uint8_t>(
+        std::countr_zero(covered_mask & ~arrangements.front().bomb_mask));
+    return state_entry;
+  }
+  if (const auto found_entry = this->findState(state_key)) return *found_entry;
+  std::array<std::uint32_t, 64> bomb_counts = {};
+  for (const auto& arrangement : arrangements)
+  {
+    for (auto bomb_mask = arrangement.bomb_mask; bomb_mask != 0; bomb_mask &= bomb_mask - 1)
+    {
+      bomb_counts[std::countr_zero(bomb_mask)]++;
+    }
+  }
+  std::vector<std::size_t> button_is;
+  for (auto mask = covered_mask; mask != 0; mask &= mask - 1)
+  {
+    const auto button_i = static_cast<std::size_t>(std::countr_zero(mask));
+    if (bomb_counts[button_i] == 0)
+    {
+      // a safe Button only adds to what is known, so no other move can do better
+      button_is.assign(1, button_i);
+      break;
+    }
+    if (bomb_counts[button_i] < arrangement_count) button_is.push_back(button_i);
+  }
+  std::stable_sort(button_is.begin(), button_is.end(), [&](std::size_t a, std::size_t b)
+                   { return bomb_counts[a] < bomb_counts[b]; });
+  for (const auto button_i : button_is)
+  {
+    const auto safe_count = arrangement_count - bomb_counts[button_i];
+    if (state_entry.button_i != NO_OPTIMAL_BUTTON && safe_count <= state_entry.win_count) break;
+    const auto win_count =
+        this->solveMove(revealed_mask, arrangements, button_i, state_entry.win_count);
+    if (state_entry.button_i == NO_OPTIMAL_BUTTON || win_count > state_entry.win_count)
+    {
+      state_entry.win_count = static_cast<std::uint32_t>(win_count);
+      state_entry.button_i = static_cast<std::uint8_t>(button_i);
+    }
+  }
+  this->storeState(state_key, state_entry);
+  return state_entry;
+}
+
+// the arrangements won by clicking a Button and then playing the best moves, where the
+// arrangements that show the same board afterwards are solved together, or a count no more than
+// best_win_count once the move cannot do better
+std::uint64_t fsweep::OptimalSolver::solveMove(std::uint64_t revealed_mask,
+                                               const std::vector<Arrangement>& arrangements,
+                                               std::size_t button_i, std::uint64_t best_win_count)
+{
+  const auto button_mask = std::uint64_t(1) << button_i;
+  std::vector<std::pair<StateKey, std::size_t>> outcomes;
+  std::vector<std::uint64_t> outcome_revealed_masks(arrangements.size(), 0);
+  for (std::size_t arrangement_i = 0; arrangement_i < arrangements.size(); arrangement_i++)
+  {
+    const auto& arrangement = arrangements[arrangement_i];
+    if ((arrangement.bomb_mask & button_mask) != 0) continue;
+    // every zero already revealed has revealed its neighbours, so only new zeros spread
+    auto new_revealed_mask = revealed_mask | button_mask;
+    auto spread_mask = revealed_mask;
+    for (auto zero_mask = new_revealed_mask & arrangement.zero_mask & ~spread_mask; zero_mask != 0;
+         zero_mask = new_revealed_mask & arrangement.zero_mask & ~spread_mask)
+    {
+      const auto zero_i = std::countr_zero(zero_mask);
+      spread_mask |= std::uint64_t(1) << zero_i;
+      new_revealed_mask |= this->neighbour_masks[zero_i];
+    }
+    outcome_revealed_masks[arrangement_i] = new_revealed_mask;
+    outcomes.emplace_back(this->getStateKey(new_revealed_mask, arrangement.bomb_mask),
+                          arrangement_i);
+  }
+  std::sort(outcomes.begin(), outcomes.end());
+  // the largest outcomes go first since they can lose the most
+  std::vector<std::pair<std::size_t, std::size_t>> outcome_ranges;
+  for (std::size_t begin = 0; begin < outcomes.size();)
+  {
+    auto end = begin + 1;
+    while (end < outcomes.size() && outcomes[end].first == outcomes[begin].first)
+    {
+      end++;
+    }
+    outcome_ranges.emplace_back(begin, end);
+    begin = end;
+  }
+  std::stable_sort(outcome_ranges.begin(), outcome_ranges.end(),
+                   [](const auto& a, const auto& b)
+                   { return a.second - a.first > b.second - b.first; });
+  std::uint64_t lost_count = 0;
+  std::vector<Arrangement> outcome_arrangements;
+  for (const auto& [begin, end] : outcome_ranges)
+  {
+    outcome_arrangements.clear();
+    for (auto outcome_i = begin; outcome_i < end; outcome_i++)
+    {
+      outcome_arrangements.push_back(arrangements[outcomes[outcome_i].second]);
+    }
+    const auto outcome_revealed_mask = outcome_revealed_masks[outcomes[begin].second];
+    const auto state_entry =
+        this->solveState(outcomes[begin].first, outcome_revealed_mask, outcome_arrangements);
+    lost_count += state_entry.arrangement_count - state_entry.win_count;
+    if (outcomes.size() - lost_count <= best_win_count) break;
+  }
+  return outcomes.size() - lost_count;
+}
+
+void fsweep::OptimalSolver::Solve(fsweep::ThreadPool& thread_pool)
+{
+  thread_pool.ParallelFor(
+      this->button_count,
+      [this](std::size_t first_i)
+      {
+        std::vector<std::size_t> button_is;
+        for (std::size_t button_i = 0; button_i < this->button_count; button_i++)
+        {
+          if (button_i != first_i) button_is.push_back(button_i);
+        }
+        // the first click is never a bomb, every other arrangement is as likely
+        std::vector<Arrangement> arrangements;
+        forEachOptimalCombination(button_is, this->bomb_count, [&](std::uint64_t bomb_mask)
+                                  { arrangements.push_back(this->getArrangement(bomb_mask)); });
+        this->first_win_counts[first_i] = this->solveMove(0, arrangements, first_i, 0);
+      });
+  this->solved = true;
+}
+
+double fsweep::OptimalSolver::GetWinProbability() const noexcept
+{
+  const auto first_click = this->GetFirstClick();
+  return this->GetFirstClickWinProbability(first_click.x, first_click.y);
+}
+
+double fsweep::OptimalSolver::GetFirstClickWinProbability(int x, int y) const noexcept
+{
+  if (!this->solved || this->first_arrangement_count == 0) return 0.0;
+  const auto button_i =
+      fsweep::ButtonPosition(x, y).GetIndex(this->game_configuration.GetButtonsWide());
+  return static_cast<double>(this->first_win_counts[button_i]) /
+         static_cast<double>(this->first_arrangement_count);
+}
+
+fsweep::ButtonPosition fsweep::OptimalSolver::GetFirstClick() const noexcept
+{
+  const auto best_it =
+      std::max_element(this->first_win_counts.begin(), this->first_win_counts.end());
+  const auto button_i = static_cast<int>(best_it - this->first_win_counts.begin());
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  return fsweep::ButtonPosition(button_i % buttons_wide, button_i / buttons_wide);
+}
+
+fsweep::OptimalSolver::StateEntry fsweep::OptimalSolver::getStateEntry(
+    const fsweep::GameModel& game_model)
+{
+  const auto game_configuration = game_model.GetGameConfiguration();
+  const auto buttons_wide = game_configuration.GetButtonsWide();
+  if (buttons_wide != this->game_configuration.GetButtonsWide() ||
+      game_configuration.GetButtonsTall() != this->game_configuration.GetButtonsTall() ||
+      game_configuration.GetBombCount() != this->game_configuration.GetBombCount())
+  {
+    throw std::runtime_error("game does not match the solver");
+  }
+  std::uint64_t revealed_mask = 0;
+  StateKey state_key = {};
+  std::vector<std::size_t> covered_is;
+  for (std::size_t button_i = 0; button_i < this->button_count; button_i++)
+  {
+    const auto& button = game_model.GetButton(static_cast<int>(button_i % buttons_wide),
+                                              static_cast<int>(button_i / buttons_wide));
+    std::uint64_t nibble = COVERED_NIBBLE;
+    if (button.GetButtonState() == fsweep::ButtonState::Down)
+    {
+      revealed_mask |= std::uint64_t(1) << button_i;
+      nibble = static_cast<std::uint64_t>(button.GetSurroundingBombs());
+    }
+    else
+    {
+      covered_is.push_back(button_i);
+    }
+    setOptimalNibble(state_key, button_i, nibble);
+  }
+  // a board the solved moves never reach is solved from the arrangements that fit its numbers
+  std::vector<Arrangement> arrangements;
+  forEachOptimalCombination(covered_is, this->bomb_count,
+                            [&](std::uint64_t bomb_mask)
+                            {
+                              if (this->getStateKey(revealed_mask, bomb_mask) == state_key)
+                              {
+                                arrangements.push_back(this->getArrangement(bomb_mask));
+                              }
+                            });
+  return this->solveState(state_key, revealed_mask, arrangements);
+}
+
+std::optional<fsweep::ButtonPosition> fsweep::OptimalSolver::GetMove(
+    const fsweep::GameModel& game_model)
+{
+  const auto game_state = game_model.GetGameState();
+  if (game_state == fsweep::GameState::None)
+  {
+    if (!this->solved) return std::nullopt;
+    return this->GetFirstClick();
+  }
+  if (game_state != fsweep::GameState::Playing) return std::nullopt;
+  const auto state_entry = this->getStateEntry(game_model);
+  if (state_entry.button_i == NO_OPTIMAL_BUTTON) return std::nullopt;
+  const auto buttons_wide = this->game_configuration.GetButtonsWide();
+  return fsweep::ButtonPosition(state_entry.button_i % buttons_wide,
+                                state_entry.button_i / buttons_wide);
+}
+
+double fsweep::OptimalSolver::GetStateWinProbability(const fsweep::GameModel& game_model)
+{
+  const auto game_state = game_model.GetGameState();
+  if (game_state == fsweep::GameState::None) return this->GetWinProbability();
+  if (game_state == fsweep::GameState::Cool) return 1.0;
+  if (game_state != fsweep::GameState::Playing) return 0.0;
+  const auto state_entry = this->getStateEntry(game_model);
+  if (state_entry.arrangement_count == 0) return 0.0;
+  return static_cast<double>(state_entry.win_count) /
+         static_cast<double>(state_entry.arrangement_count);
+}
+
+std::size_t fsweep::OptimalSolver::GetStateCount()
+{
+  std::size_t state_count = 0;
+  for (auto& shard : this->shards)
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    state_count += shard.state_entries.size();
+  }
+  return state_count;
+}
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fsweep/ReplayPlayer.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+const std::size_t fsweep::ReplayPlayer::DEFAULT_CHECKPOINT_INTERVAL = 256;
+
+fsweep::ReplayPlayer::ReplayPlayer(fsweep::ReplayReader& replay_reader,
+                                   std::size_t checkpoint_interval)
+    : game_configuration(replay_reader.GetGameConfiguration())
+    , questions_enabled(replay_reader.GetQuestionsEnabled())
+    , seed(replay_reader.GetSeed())
+    , checkpoint_interval(checkpoint_interval)
+{
+  if (checkpoint_interval == 0)
+  {
+    throw std::runtime_error("invalid checkpoint interval");
+  }
+  fsweep::ReplayEvent replay_event;
+  while (replay_reader.Read(replay_event))
+  {
+    this->replay_events.push_back(replay_event);
+  }
+  this->game_model = replay_reader.CreateGameModel();
+  for (this->event_i = 0; this->event_i < this->replay_events.size(); this->event_i++)
+  {
+    if (this->event_i % checkpoint_interval == 0)
+    {
+      this->checkpoints.push_back({this->game_model->GetGameState(),
+                                   this->game_model->GetGameTime(),
+                                   this->game_model->ToStatePlane()});
+    }
+    fsweep::ReplayReader::Play(this->replay_events[this->event_i], *this->game_model);
+  }
+  if (this->checkpoints.empty())
+  {
+    this->checkpoints.push_back({this->game_model->GetGameState(),
+                                 this->game_model->GetGameTime(),
+                                 this->game_model->ToStatePlane()});
+  }
+  if (this->game_model->GetGameState() != fsweep::GameState::None)
+  {
+    this->bomb_plane = this->game_model->ToBombPlane();
+  }
+}
+
+void fsweep::ReplayPlayer::restoreCheckpoint(std::size_t checkpoint_i)
+{
+  const auto& checkpoint = this->checkpoints[checkpoint_i];
+  // the bombs are only placed by the first click
+  const auto bomb_plane =
+      checkpoint.game_state == fsweep::GameState::None
+          ? std::vector<std::uint8_t>(
+                fsweep::GameModel::GetBombPlaneSize(this->game_configuration.GetButtonCount()))
+          : this->bomb_plane;
+  this->game_model = std::make_unique<fsweep::GameModel>(
+      this->game_configuration, this->questions_enabled, checkpoint.game_state,
+      checkpoint.game_time, bomb_plane, checkpoint.state_plane);
+  this->game_model->SetSeed(this->seed);
+  this->event_i = checkpoint_i * this->checkpoint_interval;
+}
+
+void fsweep::ReplayPlayer::Seek(std::size_t event_i)
+{
+  if (event_i > this->replay_events.size())
+  {
+    throw std::runtime_error("replay event index out of range");
+  }
+  const auto checkpoint_i =
+      std::min(event_i / this->checkpoint_interval, this->checkpoints.size() - 1);
+  if (event_i < this->event_i || this->event_i < checkpoint_i * this->checkpoint_interval)
+  {
+    this->restoreCheckpoint(checkpoint_i);
+  }
+  for (; this->event_i < event_i; this->event_i++)
+  {
+    fsweep::ReplayReader::Play(this->replay_events[this->event_i], *this->game_model);
+  }
+}
+
+std::size_t fsweep::ReplayPlayer::GetEventIndex() const noexcept { return this->event_i; }
+
+std::size_t fsweep::ReplayPlayer::GetEventCount() const noexcept
+{
+  return this->replay_events.size();
+}
+
+std::size_t fsweep::ReplayPlayer::GetCheckpointCount() const noexcept
+{
+  return this->checkpoints.size();
+}
+
+const fsweep::ReplayEvent& fsweep::ReplayPlayer::GetEvent(std::size_t event_i) const
+{
+  return this->replay_events.at(event_i);
+}
+
+const fsweep::GameModel& fsweep::ReplayPlayer::GetGameModel() const noexcept
+{
+  return *this->game_model;
+}
@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fsweep/ReplayReader.hpp>
+#include <fsweep/ReplayWriter.hpp>
+#include <stdexcept>
+
+fsweep::ReplayReader::ReplayReader(std::istream& stream) : stream(std::ref(stream))
+{
+  std::vector<std::uint8_t> header(fsweep::ReplayWriter::HEADER_SIZE);
+  for (auto& byte : header)
+  {
+    if (!this->getByte(byte))
+    {
+      throw std::runtime_error("invalid replay");
+    }
+  }
+  const auto get_fixed = [&](std::size_t offset, std::size_t byte_count)
+  {
+    std::uint64_t value = 0;
+    for (std::size_t byte_i = 0; byte_i < byte_count; byte_i++)
+    {
+      value |= static_cast<std::uint64_t>(header[offset + byte_i]) << (byte_i * 8);
+    }
+    return value;
+  };
+  if (get_fixed(0, 4) != fsweep::ReplayWriter::MAGIC)
+  {
+    throw std::runtime_error("invalid replay");
+  }
+  if (get_fixed(4, 2) > fsweep::ReplayWriter::VERSION)
+  {
+    throw std::runtime_error("unsupported replay version");
+  }
+  this->questions_enabled = (header[6] & fsweep::ReplayWriter::QUESTIONS_ENABLED_FLAG) != 0;
+  const auto buttons_wide = static_cast<std::int32_t>(get_fixed(8, 4));
+  const auto buttons_tall = static_cast<std::int32_t>(get_fixed(12, 4));
+  const auto bomb_count = static_cast<std::int32_t>(get_fixed(16, 4));
+  this->game_configuration = fsweep::GameConfiguration(buttons_wide, buttons_tall, bomb_count);
+  if (this->game_configuration.GetButtonsWide() != buttons_wide ||
+      this->game_configuration.GetButtonsTall() != buttons_tall ||
+      this->game_configuration.GetBombCount() != bomb_count)
+  {
+    throw std::runtime_error("invalid game configuration");
+  }
+  this->seed = get_fixed(20, 8);
+}
+
+bool fsweep::ReplayReader::getByte(std::uint8_t& byte)
+{
+  if (this->block_i == this->block.size())
+  {
+    auto& stream = this->stream.get();
+    this->block.resize(fsweep::ReplayWriter::BLOCK_SIZE);
+    stream.read(reinterpret_cast<char*>(this->block.data()),
+                static_cast<std::streamsize>(this->block.size()));
+    this->block.resize(static_cast<std::size_t>(stream.gcount()));
+    this->block_i = 0;
+    if (this->block.empty()) return false;
+  }
+  byte = this->block[this->block_i++];
+  return true;
+}
+
+std::uint8_t fsweep::ReplayReader::getEventByte()
+{
+  std::uint8_t byte = 0;
+  if (!this->getByte(byte))
+  {
+    throw std::runtime_error("truncated replay event");
+  }
+  return byte;
+}
+
+std::uint64_t fsweep::ReplayReader::getVarint(std::uint8_t byte)
+{
+  std::uint64_t value = byte & 0x7f;
+  for (int shift = 7; (byte & 0x80) != 0; shift += 7)
+  {
+    if (shift >= 64)
+    {
+      throw std::runtime_error("invalid replay varint");
+    }
+    byte = this->getEventByte();
+    value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+  }
+  return value;
+}
+
+namespace
+{
+  std::int64_t getUnzigzag(std::uint64_t value) noexcept
+  {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+  }
+}  // namespace
+
+bool fsweep::ReplayReader::Read(fsweep::ReplayEvent& replay_event)
+{
+  std::uint8_t byte = 0;
+  // a replay may end after any event
+  if (!this->getByte(byte)) return false;
+  const auto key = this->getVarint(byte);
+  if ((key & 0b11) > static_cast<std::uint64_t>(fsweep::GameAction::AreaClick))
+  {
+    throw std::runtime_error("invalid replay event");
+  }
+  std::int64_t x = this->last_x;
+  std::int64_t y = this->last_y;
+  if ((key & 0b100) != 0)
+  {
+    const auto offsets = this->getEventByte();
+    x += (offsets & 0x0f) - fsweep::ReplayWriter::NEAR_OFFSET;
+    y += (offsets >> 4) - fsweep::ReplayWriter::NEAR_OFFSET;
+  }
+  else
+  {
+    x += getUnzigzag(this->getVarint(this->getEventByte()));
+    y += getUnzigzag(this->getVarint(this->getEventByte()));
+  }
+  if (x < 0 || x >= this->game_configuration.GetButtonsWide() || y < 0 ||
+      y >= this->game_configuration.GetButtonsTall())
+  {
+    throw std::runtime_error("invalid replay event position");
+  }
+  this->last_deciseconds += key >> 3;
+  this->last_x = static_cast<int>(x);
+  this->last_y = static_cast<int>(y);
+  replay_event = fsweep::ReplayEvent(
+      static_cast<unsigned long>(this->last_deciseconds *
+                                 fsweep::ReplayWriter::MILLISECONDS_PER_DECISECOND),
+      static_cast<fsweep::GameAction>(key & 0b11), this->last_x, this->last_y);
+  return true;
+}
+
+fsweep::GameConfiguration fsweep::ReplayReader::GetGameConfiguration() const noexcept
+{
+  return this->game_configuration;
+}
+
+bool fsweep::ReplayReader::GetQuestionsEnabled() const noexcept { return this->questions_enabled; }
+
+std::uint64_t fsweep::ReplayReader::GetSeed() const noexcept { return this->seed; }
+
+std::unique_ptr<fsweep::GameModel> fsweep::ReplayReader::CreateGameModel() const
+{
+  auto game_model = std::make_unique<fsweep::GameModel>();
+  game_model->NewGame(this->game_configuration);
+  game_model->SetQuestionsEnabled(this->questions_enabled);
+  game_model->SetSeed(this->seed);
+  return game_model;
+}
+
+void fsweep::ReplayReader::Play(const fsweep::ReplayEvent& replay_event,
+                                fsweep::GameModel& game_model)
+{
+  game_model.UpdateTime(static_cast<unsigned int>(replay_event.game_time));
+  switch (replay_event.game_action)
+  {
+  case fsweep::GameAction::Click:
+    game_model.ClickButton(replay_event.x, replay_event.y);
+    break;
+  case fsweep::GameAction::AltClick:
+    game_model.AltClickButton(replay_event.x, replay_event.y);
+    break;
+  case fsweep::GameAction::AreaClick:
+    game_model.AreaClickButton(replay_event.x, replay_event.y);
+    break;
+  }
+}
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <fsweep/ReplayWriter.hpp>
+#include <stdexcept>
+#include <utility>
+
+const std::uint32_t fsweep::ReplayWriter::MAGIC = 0x50525346;  // "FSRP"
+const std::uint16_t fsweep::ReplayWriter::VERSION = 1;
+const std::size_t fsweep::ReplayWriter::HEADER_SIZE = 28;
+const std::size_t fsweep::ReplayWriter::BLOCK_SIZE = 1 << 12;
+
+const std::uint8_t fsweep::ReplayWriter::QUESTIONS_ENABLED_FLAG = 0b00000001;
+const unsigned long fsweep::ReplayWriter::MILLISECONDS_PER_DECISECOND = 100;
+const int fsweep::ReplayWriter::NEAR_OFFSET = 8;
+
+fsweep::ReplayWriter::ReplayWriter(std::ostream& stream,
+                                   const fsweep::GameConfiguration& game_configuration,
+                                   bool questions_enabled, std::uint64_t seed)
+    : stream(std::ref(stream))
+{
+  this->block.reserve(fsweep::ReplayWriter::BLOCK_SIZE);
+  const auto put_fixed = [&](std::uint64_t value, std::size_t byte_count)
+  {
+    for (std::size_t byte_i = 0; byte_i < byte_count; byte_i++)
+    {
+      this->putByte(static_cast<std::uint8_t>(value >> (byte_i * 8)));
+    }
+  };
+  put_fixed(fsweep::ReplayWriter::MAGIC, 4);
+  put_fixed(fsweep::ReplayWriter::VERSION, 2);
+  put_fixed(questions_enabled ? fsweep::ReplayWriter::QUESTIONS_ENABLED_FLAG : 0, 1);
+  put_fixed(0, 1);
+  put_fixed(static_cast<std::uint32_t>(game_configuration.GetButtonsWide()), 4);
+  put_fixed(static_cast<std::uint32_t>(game_configuration.GetButtonsTall()), 4);
+  put_fixed(static_cast<std::uint32_t>(game_configuration.GetBombCount()), 4);
+  put_fixed(seed, 8);
+  this->thread = std::thread(&fsweep::ReplayWriter::threadLoop, this);
+}
+
+fsweep::ReplayWriter::~ReplayWriter()
+{
+  if (!this->block.empty())
+  {
+    this->queueBlock();
+  }
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stopping = true;
+  }
+  this->block_condition.notify_all();
+  this->thread.join();
+  this->stream.get().flush();
+}
+
+void fsweep::ReplayWriter::threadLoop()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true)
+  {
+    this->block_condition.wait(lock,
+                               [this]() { return this->stopping || !this->full_blocks.empty(); });
+    // the blocks left when stopping are still written
+    if (this->full_blocks.empty()) return;
+    auto full_block = std::move(this->full_blocks.front());
+    this->full_blocks.pop_front();
+    this->writing = true;
+    lock.unlock();
+    auto& stream = this->stream.get();
+    stream.write(reinterpret_cast<const char*>(full_block.data()),
+                 static_cast<std::streamsize>(full_block.size()));
+    const bool written = static_cast<bool>(stream);
+    lock.lock();
+    this->failed = this->failed || !written;
+    full_block.clear();
+    this->free_blocks.push_back(std::move(full_block));
+    this->writing = false;
+    this->done_condition.notify_all();
+  }
+}
+
+void fsweep::ReplayWriter::putByte(std::uint8_t byte)
+{
+  this->block.push_back(byte);
+  if (this->block.size() == fsweep::ReplayWriter::BLOCK_SIZE)
+  {
+    this->queueBlock();
+  }
+}
+
+void fsweep::ReplayWriter::putVarint(std::uint64_t value)
+{
+  while (value >= 0x80)
+  {
+    this->putByte(static_cast<std::uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  this->putByte(static_cast<std::uint8_t>(value));
+}
+
+void fsweep::ReplayWriter::queueBlock()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->full_blocks.push_back(std::move(this->block));
+    if (this->free_blocks.empty())
+    {
+      this->block = std::vector<std::uint8_t>();
+      this->block.reserve(fsweep::ReplayWriter::BLOCK_SIZE);
+    }
+    else
+    {
+      this->block = std::move(this->free_blocks.back());
+      this->free_blocks.pop_back();
+    }
+  }
+  this->block_condition.notify_one();
+}
+
+namespace
+{
+  std::uint64_t getZigzag(std::int64_t value) noexcept
+  {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+  }
+}  // namespace
+
+void fsweep::ReplayWriter::Write(const fsweep::ReplayEvent& replay_event)
+{
+  const std::uint64_t deciseconds =
+      replay_event.game_time / fsweep::ReplayWriter::MILLISECONDS_PER_DECISECOND;
+  if (deciseconds < this->last_deciseconds)
+  {
+    throw std::runtime_error("replay event is earlier than the last replay event");
+  }
+  const std::int64_t x_offset = static_cast<std::int64_t>(replay_event.x) - this->last_x;
+  const std::int64_t y_offset = static_cast<std::int64_t>(replay_event.y) - this->last_y;
+  const std::int64_t near_offset = fsweep::ReplayWriter::NEAR_OFFSET;
+  const bool near = x_offset >= -near_offset && x_offset < near_offset &&
+                    y_offset >= -near_offset && y_offset < near_offset;
+  this->putVarint(((deciseconds - this->last_deciseconds) << 3) |
+                  (static_cast<std::uint64_t>(near) << 2) |
+                  static_cast<std::uint64_t>(replay_event.game_action));
+  if (near)
+  {
+    this->putByte(static_cast<std::uint8_t>((x_offset + near_offset) |
+                                            ((y_offset + near_offset) << 4)));
+  }
+  else
+  {
+    this->putVarint(getZigzag(x_offset));
+    this->putVarint(getZigzag(y_offset));
+  }
+  this->last_deciseconds = deciseconds;
+  this->last_x = replay_event.x;
+  this->last_y = replay_event.y;
+  this->event_count++;
+}
+
+void fsweep::ReplayWriter::Flush()
+{
+  if (!this->block.empty())
+  {
+    this->queueBlock();
+  }
+  std::unique_lock<std::mutex> lock(this->mutex);
+  this->done_condition.wait(lock,
+                            [this]() { return this->full_blocks.empty() && !this->writing; });
+  // the background thread is idle until the next block is queued
+  this->stream.get().flush();
+  if (this->failed || !this->stream.get())
+  {
+    throw std::runtime_error("could not write replay");
+  }
+}
+
+std::size_t fsweep::ReplayWriter::GetEventCount() const noexcept { return this->event_count; }
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/RiskLayer.hpp>
+#include <span>
+#include <vector>
+
+const std::uint8_t fsweep::RiskLayer::LEVEL_COUNT = 16;
+const std::uint8_t fsweep::RiskLayer::NO_LEVEL = 0xff;
+const float fsweep::RiskLayer::NO_RISK = -1.0f;
+const float fsweep::RiskLayer::RISK_THRESHOLD = 0.05f;
+
+std::uint8_t fsweep::RiskLayer::GetRiskLevel(float risk) noexcept
+{
+  if (risk < 0.0f) return fsweep::RiskLayer::NO_LEVEL;
+  if (risk >= 1.0f) return fsweep::RiskLayer::LEVEL_COUNT - 1;
+  return static_cast<std::uint8_t>(std::lround(risk * (fsweep::RiskLayer::LEVEL_COUNT - 1)));
+}
+
+// returns whether the layer was reset for a different Button count, in which case every Button
+// with a risk is changed
+bool fsweep::RiskLayer::Update(std::span<const float> risks, std::vector<std::size_t>& changed_is)
+{
+  const bool reset = risks.size() != this->risks.size();
+  if (reset)
+  {
+    this->risks.assign(risks.size(), fsweep::RiskLayer::NO_RISK);
+    this->levels.assign(risks.size(), fsweep::RiskLayer::NO_LEVEL);
+  }
+  for (std::size_t button_i = 0; button_i < risks.size(); button_i++)
+  {
+    const auto risk = risks[button_i];
+    const auto level = fsweep::RiskLayer::GetRiskLevel(risk);
+    if (level == this->levels[button_i]) continue;
+    const bool is_shown = level == fsweep::RiskLayer::NO_LEVEL ||
+                          this->levels[button_i] == fsweep::RiskLayer::NO_LEVEL ||
+                          risk == 0.0f || risk == 1.0f ||
+                          std::abs(risk - this->risks[button_i]) >=
+                              fsweep::RiskLayer::RISK_THRESHOLD;
+    if (!is_shown) continue;
+    this->risks[button_i] = risk;
+    this->levels[button_i] = level;
+    changed_is.push_back(button_i);
+  }
+  return reset;
+}
+
+void fsweep::RiskLayer::Clear() noexcept
+{
+  this->risks.clear();
+  this->levels.clear();
+}
+
+std::uint8_t fsweep::RiskLayer::GetLevel(std::size_t button_i) const noexcept
+{
+  return this->levels[button_i];
+}
+
+std::size_t fsweep::RiskLayer::GetButtonCount() const noexcept { return this->levels.size(); }
@@ -0,0 +1,430 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/CounterRng.hpp>
+#include <fsweep/RiskSampler.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <vector>
+
+const std::chrono::microseconds fsweep::RiskSampler::DEFAULT_TIME_BUDGET =
+    std::chrono::microseconds(4000);
+const double fsweep::RiskSampler::PENALTY = 2.0;
+const std::size_t fsweep::RiskSampler::BATCH_SIZE = 64;
+const std::size_t fsweep::RiskSampler::MAX_BATCH_COUNT = 256;
+
+const std::size_t BURN_IN_SWEEPS = 16;
+const int MAX_PENALTY_STEP = 64;
+const double MARGIN_Z = 1.96;
+
+namespace
+{
+  // the constraints with columns in place of Buttons, indexed both ways and split into components
+  // that share no column
+  struct SamplerSystem
+  {
+    std::vector<std::size_t> constraint_starts = std::vector<std::size_t>();
+    std::vector<std::size_t> constraint_columns = std::vector<std::size_t>();
+    std::vector<int> bomb_counts = std::vector<int>();
+    std::vector<std::size_t> column_starts = std::vector<std::size_t>();
+    std::vector<std::size_t> column_constraints = std::vector<std::size_t>();
+    std::vector<std::size_t> constraint_components = std::vector<std::size_t>();
+    std::vector<std::size_t> component_starts = std::vector<std::size_t>();
+    std::vector<std::size_t> component_columns = std::vector<std::size_t>();
+    std::vector<double> penalty_factors = std::vector<double>();
+    std::int64_t interior_count = 0;
+    std::int64_t bombs_left = 0;
+  };
+
+  struct SamplerChain
+  {
+    std::vector<std::uint64_t> bomb_sums = std::vector<std::uint64_t>();
+    std::vector<double> batch_risk_sums = std::vector<double>();
+    std::vector<double> batch_risk_squares = std::vector<double>();
+    std::vector<std::uint64_t> sample_counts = std::vector<std::uint64_t>();
+    std::vector<std::size_t> batch_counts = std::vector<std::size_t>();
+  };
+
+  std::size_t findSamplerRoot(std::vector<std::size_t>& parents, std::size_t column_i)
+  {
+    while (parents[column_i] != column_i)
+    {
+      parents[column_i] = parents[parents[column_i]];
+      column_i = parents[column_i];
+    }
+    return column_i;
+  }
+
+  std::uint64_t getSamplerIndex(std::uint64_t value, std::size_t count)
+  {
+    return ((value >> 32) * count) >> 32;
+  }
+
+  double getSamplerUnit(std::uint64_t value) { return static_cast<double>(value >> 11) * 0x1p-53; }
+
+  void runSamplerChain(const SamplerSystem& system, SamplerChain& chain, std::uint64_t seed,
+                       std::chrono::steady_clock::time_point deadline)
+  {
+    const auto column_count = system.column_starts.size() - 1;
+    const auto constraint_count = system.bomb_counts.size();
+    const auto component_count = system.component_starts.size() - 1;
+    std::uint64_t counter = 0;
+    const auto next = [&]() { return fsweep::CounterRng::Get(seed, counter++); };
+
+    std::vector<std::uint8_t> has_bombs(column_count, 0);
+    std::vector<int> sums(constraint_count, 0);
+    std::vector<std::int64_t> violations(component_count, 0);
+    for (std::size_t constraint_i = 0; constraint_i < constraint_count; constraint_i++)
+    {
+      violations[system.constraint_components[constraint_i]] +=
+          std::abs(system.bomb_counts[constraint_i]);
+    }
+    // bombs_left less the bombs placed are left for the interior, where they have to fit
+    std::int64_t interior_bombs = system.bombs_left;
+    const auto flip = [&](std::size_t column_i)
+    {
+      const int step = has_bombs[column_i] ? -1 : 1;
+      has_bombs[column_i] = static_cast<std::uint8_t>(!has_bombs[column_i]);
+      interior_bombs -= step;
+      std::int64_t violation_step = 0;
+      for (auto i = system.column_starts[column_i]; i < system.column_starts[column_i + 1]; i++)
+      {
+        const auto constraint_i = system.column_constraints[i];
+        const auto bomb_count = system.bomb_counts[constraint_i];
+        const auto constraint_step = std::abs(sums[constraint_i] + step - bomb_count) -
+                                     std::abs(sums[constraint_i] - bomb_count);
+        sums[constraint_i] += step;
+        violations[system.constraint_components[constraint_i]] += constraint_step;
+        violation_step += constraint_step;
+      }
+      return violation_step;
+    };
+    for (auto column_i = getSamplerIndex(next(), column_count);
+         interior_bombs > system.interior_count; column_i = (column_i + 1) % column_count)
+    {
+      if (!has_bombs[column_i]) flip(column_i);
+    }
+
+    const auto accept = [&](double ratio, std::int64_t violation_step)
+    {
+      if (violation_step > MAX_PENALTY_STEP) return false;
+      if (violation_step >= -MAX_PENALTY_STEP)
+      {
+        ratio *= system.penalty_factors[violation_step + MAX_PENALTY_STEP];
+      }
+      return ratio >= 1.0 || getSamplerUnit(next()) < ratio;
+    };
+    const auto propose = [&]()
+    {
+      const auto column_i = getSamplerIndex(next(), column_count);
+      const auto choice = next();
+      if (choice & 1)
+      {
+        // a single flip moves a bomb between the column and the interior, which changes the number
+        // of interior arrangements by the ratio of neighbouring binomial coefficients
+        const auto count = system.interior_count;
+        const auto bombs = interior_bombs;
+        const bool adds_bomb = !has_bombs[column_i];
+        if (adds_bomb ? bombs == 0 : bombs == count) return;
+        const double ratio = adds_bomb ? static_cast<double>(bombs) / (count - bombs + 1)
+                                       : static_cast<double>(count - bombs) / (bombs + 1);
+        if (!accept(ratio, flip(column_i))) flip(column_i);
+        return;
+      }
+      // a swap with a column of one of the same constraints keeps the number of bombs
+      const auto begin = system.column_starts[column_i];
+      const auto end = system.column_starts[column_i + 1];
+      const auto constraint_i =
+          system.column_constraints[begin + getSamplerIndex(choice >> 1, end - begin)];
+      const auto constraint_begin = system.constraint_starts[constraint_i];
+      const auto constraint_end = system.constraint_starts[constraint_i + 1];
+      const auto other_i =
+          constraint_begin + getSamplerIndex(next(), constraint_end - constraint_begin);
+      const auto other_column_i = system.constraint_columns[other_i];
+      if (has_bombs[column_i] == has_bombs[other_column_i]) return;
+      const auto violation_step = flip(column_i) + flip(other_column_i);
+      if (!accept(1.0, violation_step))
+      {
+        flip(other_column_i);
+        flip(column_i);
+      }
+    };
+
+    // a component is counted whenever it misses none of its constraints, which stays likely with
+    // thousands of constraints where all of them at once would not
+    std::vector<std::uint32_t> batch_bomb_counts(column_count, 0);
+    std::vector<std::size_t> batch_sample_counts(component_count, 0);
+    std::size_t done_count = 0;
+    for (std::size_t sweep_i = 0;
+         done_count < component_count && std::chrono::steady_clock::now() < deadline; sweep_i++)
+    {
+      for (std::size_t step_i = 0; step_i < column_count; step_i++)
+      {
+        propose();
+      }
+      if (sweep_i < BURN_IN_SWEEPS) continue;
+      for (std::size_t component_i = 0; component_i < component_count; component_i++)
+      {
+        if (violations[component_i] != 0 ||
+            chain.batch_counts[component_i] == fsweep::RiskSampler::MAX_BATCH_COUNT)
+        {
+          continue;
+        }
+        const auto begin = system.component_starts[component_i];
+        const auto end = system.component_starts[component_i + 1];
+        for (auto i = begin; i < end; i++)
+        {
+          batch_bomb_counts[system.component_columns[i]] += has_bombs[system.component_columns[i]];
+        }
+        chain.sample_counts[component_i]++;
+        if (++batch_sample_counts[component_i] < fsweep::RiskSampler::BATCH_SIZE) continue;
+        for (auto i = begin; i < end; i++)
+        {
+          const auto column_i = system.component_columns[i];
+          const auto risk = static_cast<double>(batch_bomb_counts[column_i]) /
+                            fsweep::RiskSampler::BATCH_SIZE;
+          chain.batch_risk_sums[column_i] += risk;
+          chain.batch_risk_squares[column_i] += risk * risk;
+          chain.bomb_sums[column_i] += batch_bomb_counts[column_i];
+          batch_bomb_counts[column_i] = 0;
+        }
+        batch_sample_counts[component_i] = 0;
+        if (++chain.batch_counts[component_i] == fsweep::RiskSampler::MAX_BATCH_COUNT) done_count++;
+      }
+    }
+    for (std::size_t column_i = 0; column_i < column_count; column_i++)
+    {
+      chain.bomb_sums[column_i] += batch_bomb_counts[column_i];
+    }
+  }
+}  // namespace
+
+fsweep::RiskSampler::RiskSampler(fsweep::ThreadPool& thread_pool) noexcept
+    : thread_pool(thread_pool)
+{
+}
+
+void fsweep::RiskSampler::SetTimeBudget(std::chrono::microseconds time_budget) noexcept
+{
+  this->time_budget = time_budget;
+}
+
+std::chrono::microseconds fsweep::RiskSampler::GetTimeBudget() const noexcept
+{
+  return this->time_budget;
+}
+
+void fsweep::RiskSampler::AddConstraint(std::span<const std::size_t> button_is, int bomb_count)
+{
+  if (button_is.empty()) return;
+  this->constraint_starts.push_back(this->constraint_button_is.size());
+  this->constraint_button_is.insert(this->constraint_button_is.end(), button_is.begin(),
+                                    button_is.end());
+  this->bomb_counts.push_back(bomb_count);
+}
+
+void fsweep::RiskSampler::Clear() noexcept
+{
+  this->constraint_button_is.clear();
+  this->constraint_starts.clear();
+  this->bomb_counts.clear();
+  this->button_is.clear();
+  this->risks.clear();
+  this->margins.clear();
+  this->interior_risk = 0.0f;
+  this->sample_count = 0;
+}
+
+void fsweep::RiskSampler::Sample(std::int64_t interior_count, std::int64_t bombs_left,
+                                 std::uint64_t seed)
+{
+  const auto deadline = std::chrono::steady_clock::now() + this->time_budget;
+  this->button_is = this->constraint_button_is;
+  std::sort(this->button_is.begin(), this->button_is.end());
+  this->button_is.erase(std::unique(this->button_is.begin(), this->button_is.end()),
+                        this->button_is.end());
+  const auto column_count = this->button_is.size();
+  const auto constraint_count = this->bomb_counts.size();
+  this->risks.assign(column_count, 0.0f);
+  this->margins.assign(column_count, 1.0f);
+  this->interior_risk = interior_count > 0 ? std::clamp(static_cast<float>(bombs_left) /
+                                                            interior_count,
+                                                        0.0f, 1.0f)
+                                           : 0.0f;
+  this->sample_count = 0;
+  if (column_count == 0 || interior_count < 0 || bombs_left < 0 ||
+      bombs_left > interior_count + static_cast<std::int64_t>(column_count))
+  {
+    return;
+  }
+
+  SamplerSystem system;
+  system.constraint_starts = this->constraint_starts;
+  system.constraint_starts.push_back(this->constraint_button_is.size());
+  system.constraint_columns.reserve(this->constraint_button_is.size());
+  system.column_starts.assign(column_count + 1, 0);
+  for (const auto button_i : this->constraint_button_is)
+  {
+    const auto column_i = static_cast<std::size_t>(
+        std::lower_bound(this->button_is.begin(), this->button_is.end(), button_i) -
+        this->button_is.begin());
+    system.constraint_columns.push_back(column_i);
+    system.column_starts[column_i + 1]++;
+  }
+  for (std::size_t column_i = 0; column_i < column_count; column_i++)
+  {
+    system.column_starts[column_i + 1] += system.column_starts[column_i];
+  }
+  system.column_constraints.resize(this->constraint_button_is.size());
+  auto column_ends = system.column_starts;
+  std::vector<std::size_t> parents(column_count);
+  std::iota(parents.begin(), parents.end(), 0);
+  for (std::size_t constraint_i = 0; constraint_i < constraint_count; constraint_i++)
+  {
+    const auto begin = system.constraint_starts[constraint_i];
+    const auto root = findSamplerRoot(parents, system.constraint_columns[begin]);
+    for (auto i = begin; i < system.constraint_starts[constraint_i + 1]; i++)
+    {
+      const auto column_i = system.constraint_columns[i];
+      system.column_constraints[column_ends[column_i]++] = constraint_i;
+      parents[findSamplerRoot(parents, column_i)] = root;
+    }
+  }
+  std::vector<std::size_t> column_components(column_count, 0);
+  std::vector<std::size_t> root_components(column_count, column_count);
+  std::size_t component_count = 0;
+  for (std::size_t column_i = 0; column_i < column_count; column_i++)
+  {
+    auto& component_i = root_components[findSamplerRoot(parents, column_i)];
+    if (component_i == column_count) component_i = component_count++;
+    column_components[column_i] = component_i;
+  }
+  system.component_starts.assign(component_count + 1, 0);
+  for (const auto component_i : column_components)
+  {
+    system.component_starts[component_i + 1]++;
+  }
+  for (std::size_t component_i = 0; component_i < component_count; component_i++)
+  {
+    system.component_starts[component_i + 1] += system.component_starts[component_i];
+  }
+  system.component_columns.resize(column_count);
+  auto component_ends = system.component_starts;
+  for (std::size_t column_i = 0; column_i < column_count; column_i++)
+  {
+    system.component_columns[component_ends[column_components[column_i]]++] = column_i;
+  }
+  for (std::size_t constraint_i = 0; constraint_i < constraint_count; constraint_i++)
+  {
+    system.constraint_components.push_back(
+        column_components[system.constraint_columns[system.constraint_starts[constraint_i]]]);
+  }
+  system.bomb_counts = this->bomb_counts;
+  for (int violation_step = -MAX_PENALTY_STEP; violation_step <= MAX_PENALTY_STEP;
+       violation_step++)
+  {
+    system.penalty_factors.push_back(std::exp(-fsweep::RiskSampler::PENALTY * violation_step));
+  }
+  system.interior_count = interior_count;
+  system.bombs_left = bombs_left;
+
+  auto& thread_pool = this->thread_pool.get();
+  std::vector<SamplerChain> chains(thread_pool.GetThreadCount());
+  for (auto& chain : chains)
+  {
+    chain.bomb_sums.assign(column_count, 0);
+    chain.batch_risk_sums.assign(column_count, 0.0);
+    chain.batch_risk_squares.assign(column_count, 0.0);
+    chain.sample_counts.assign(component_count, 0);
+    chain.batch_counts.assign(component_count, 0);
+  }
+  thread_pool.ParallelFor(chains.size(),
+                          [&](std::size_t chain_i)
+                          {
+                            runSamplerChain(system, chains[chain_i],
+                                            fsweep::CounterRng::Get(seed, chain_i), deadline);
+                          });
+
+  this->sample_count = std::numeric_limits<std::uint64_t>::max();
+  for (std::size_t component_i = 0; component_i < component_count; component_i++)
+  {
+    std::uint64_t sample_count = 0;
+    std::size_t batch_count = 0;
+    for (const auto& chain : chains)
+    {
+      sample_count += chain.sample_counts[component_i];
+      batch_count += chain.batch_counts[component_i];
+    }
+    this->sample_count = std::min(this->sample_count, sample_count);
+    if (sample_count == 0) continue;
+    for (auto i = system.component_starts[component_i];
+         i < system.component_starts[component_i + 1]; i++)
+    {
+      const auto column_i = system.component_columns[i];
+      std::uint64_t bomb_sum = 0;
+      double batch_risk_sum = 0.0;
+      double batch_risk_square = 0.0;
+      for (const auto& chain : chains)
+      {
+        bomb_sum += chain.bomb_sums[column_i];
+        batch_risk_sum += chain.batch_risk_sums[column_i];
+        batch_risk_square += chain.batch_risk_squares[column_i];
+      }
+      this->risks[column_i] = static_cast<float>(static_cast<double>(bomb_sum) / sample_count);
+      if (batch_count < 2) continue;
+      // the batch means are close to independent, so their spread bounds the mean of all samples
+      const double mean = batch_risk_sum / batch_count;
+      const double variance =
+          std::max(batch_risk_square - batch_count * mean * mean, 0.0) / (batch_count - 1);
+      this->margins[column_i] = static_cast<float>(MARGIN_Z * std::sqrt(variance / batch_count));
+    }
+  }
+  if (this->sample_count == 0 || interior_count == 0) return;
+  // the bombs that the frontier is expected to hold leave the rest to the interior
+  double frontier_bombs = 0.0;
+  for (const auto risk : this->risks)
+  {
+    frontier_bombs += risk;
+  }
+  this->interior_risk =
+      static_cast<float>(std::clamp((bombs_left - frontier_bombs) / interior_count, 0.0, 1.0));
+}
+
+std::span<const std::size_t> fsweep::RiskSampler::GetButtons() const noexcept
+{
+  return this->button_is;
+}
+
+std::span<const float> fsweep::RiskSampler::GetRisks() const noexcept { return this->risks; }
+
+std::span<const float> fsweep::RiskSampler::GetMargins() const noexcept { return this->margins; }
+
+float fsweep::RiskSampler::GetInteriorRisk() const noexcept { return this->interior_risk; }
+
+std::uint64_t fsweep::RiskSampler::GetSampleCount() const noexcept { return this->sample_count; }
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *model
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <fsweep/ThreadPool.hpp>
+
+fsweep::ThreadPool::ThreadPool(unsigned int thread_count)
+{
+  // the thread calling ParallelFor runs tasks too
+  for (unsigned int thread_i = 1; thread_i < thread_count; thread_i++)
+  {
+    this->threads.emplace_back([this]() { this->threadLoop(); });
+  }
+}
+
+fsweep::ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->stopping = true;
+  }
+  this->task_condition.notify_all();
+  for (auto& thread : this->threads)
+  {
+    thread.join();
+  }
+}
+
+fsweep::ThreadPool& fsweep::ThreadPool::GetInstance()
+{
+  static fsweep::ThreadPool thread_pool(std::max(std::thread::hardware_concurrency(), 1u));
+  return thread_pool;
+}
+
+void fsweep::ThreadPool::threadLoop()
+{
+  std::size_t seen_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->task_condition.wait(
+          lock, [&]() { return this->stopping || this->generation != seen_generation; });
+      if (this->stopping) return;
+      seen_generation = this->generation;
+      this->active_threads++;
+    }
+    this->runTasks();
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->active_threads--;
+    }
+    this->done_condition.notify_all();
+  }
+}
+
+void fsweep::ThreadPool::runTasks()
+{
+  while (true)
+  {
+    const auto task_i = this->next_task_i.fetch_add(1);
+    if (task_i >= this->task_count) return;
+    (*this->task)(task_i);
+    this->tasks_done.fetch_add(1);
+  }
+}
+
+void fsweep::ThreadPool::ParallelFor(std::size_t task_count,
+                                     const std::function<void(std::size_t)>& task)
+{
+  if (this->threads.empty() || task_count <= 1)
+  {
+    for (std::size_t task_i = 0; task_i < task_count; task_i++)
+    {
+      task(task_i);
+    }
+    return;
+  }
+  std::lock_guard<std::mutex> parallel_for_lock(this->parallel_for_mutex);
+  {
+    // threads only read the task while they are active, so it is only changed when none are
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->done_condition.wait(lock, [&]() { return this->active_threads == 0; });
+    this->task = &task;
+    this->task_count = task_count;
+    this->next_task_i = 0;
+    this->tasks_done = 0;
+    this->generation++;
+  }
+  this->task_condition.notify_all();
+  this->runTasks();
+  std::unique_lock<std::mutex> lock(this->mutex);
+  this->done_condition.wait(
+      lock, [&]() { return this->tasks_done == task_count && this->active_threads == 0; });
+}
+
+unsigned int fsweep::ThreadPool::GetThreadCount() const noexcept
+{
+  return static_cast<unsigned int>(this->threads.size()) + 1;
+}
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <fsweep/Trace.hpp>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  std::size_t getTraceThreadId()
+  {
+    return std::hash<std::thread::id>()(std::this_thread::get_id()) % 1000000;
+  }
+}  // namespace
+
+fsweep::TraceRecorder& fsweep::TraceRecorder::GetInstance()
+{
+  static fsweep::TraceRecorder trace_recorder;
+  return trace_recorder;
+}
+
+double fsweep::TraceRecorder::GetTimestamp() const noexcept
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - this->origin)
+      .count();
+}
+
+void fsweep::TraceRecorder::RecordZone(const char* name, double start_us, double end_us)
+{
+  fsweep::TraceEvent event;
+  event.type = fsweep::TraceEventType::Zone;
+  event.name = name;
+  event.thread_id = getTraceThreadId();
+  event.start_us = start_us;
+  event.duration_us = end_us - start_us;
+  const std::lock_guard<std::mutex> lock(this->events_mutex);
+  this->events.push_back(event);
+}
+
+void fsweep::TraceRecorder::RecordCounter(const char* name, long long value)
+{
+  fsweep::TraceEvent event;
+  event.type = fsweep::TraceEventType::Counter;
+  event.name = name;
+  event.thread_id = getTraceThreadId();
+  event.start_us = this->GetTimestamp();
+  event.value = value;
+  const std::lock_guard<std::mutex> lock(this->events_mutex);
+  this->events.push_back(event);
+}
+
+void fsweep::TraceRecorder::Clear()
+{
+  const std::lock_guard<std::mutex> lock(this->events_mutex);
+  this->events.clear();
+}
+
+std::vector<fsweep::TraceEvent> fsweep::TraceRecorder::GetEvents()
+{
+  const std::lock_guard<std::mutex> lock(this->events_mutex);
+  return this->events;
+}
+
+void fsweep::TraceRecorder::WriteChromeTrace(std::ostream& stream)
+{
+  const std::lock_guard<std::mutex> lock(this->events_mutex);
+  const auto stream_flags = stream.flags();
+  const auto stream_precision = stream.precision();
+  // the default precision would round timestamps after the first second to 10us or worse
+  stream << std::fixed << std::setprecision(3);
+  stream << "{\"traceEvents\":[";
+  for (std::size_t event_i = 0; event_i < this->events.size(); event_i++)
+  {
+    const auto& event = this->events[event_i];
+    if (event_i != 0) stream << ",";
+    stream << "\n{\"name\":\"" << event.name << "\",\"cat\":\"fsweep\",\"pid\":1,\"tid\":"
+           << event.thread_id << ",\"ts\":" << event.start_us;
+    if (event.type == fsweep::TraceEventType::Zone)
+    {
+      stream << ",\"ph\":\"X\",\"dur\":" << event.duration_us << "}";
+    }
+    else
+    {
+      stream << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value << "}}";
+    }
+  }
+  stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  stream.flags(stream_flags);
+  stream.precision(stream_precision);
+}
+
+bool fsweep::TraceRecorder::WriteChromeTrace(std::string_view path)
+{
+  std::ofstream stream{std::string(path)};
+  if (!stream) return false;
+  this->WriteChromeTrace(stream);
+  return static_cast<bool>(stream);
+}
+
+fsweep::TraceZone::TraceZone(const char* name) noexcept
+    : name(name), start_us(fsweep::TraceRecorder::GetInstance().GetTimestamp())
+{
+}
+
+fsweep::TraceZone::~TraceZone()
+{
+  auto& trace_recorder = fsweep::TraceRecorder::GetInstance();
+  trace_recorder.RecordZone(this->name, this->start_us, trace_recorder.GetTimestamp());
+}
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameDifficulty.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/Strategy.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "Arena.hpp"
+#include "ArenaResult.hpp"
+#include "RandomStrategy.hpp"
+#include "RuleStrategy.hpp"
+
+namespace
+{
+  // what the strategies of one kind saw, shared by every game they play
+  struct ArenaLog
+  {
+    std::mutex mutex = std::mutex();
+    // the seed and the board hash at the first move of every game
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> boards =
+        std::vector<std::pair<std::uint64_t, std::uint64_t>>();
+    std::uint64_t move_count = 0;
+  };
+
+  // plays the moves of another strategy and writes down the boards it is given
+  class LoggingStrategy : public fsweep::Strategy
+  {
+   private:
+    std::unique_ptr<fsweep::Strategy> strategy;
+    ArenaLog& arena_log;
+    std::uint64_t seed = 0;
+    bool first_move = true;
+
+   public:
+    LoggingStrategy(std::unique_ptr<fsweep::Strategy> strategy, ArenaLog& arena_log)
+        : strategy(std::move(strategy)), arena_log(arena_log)
+    {
+    }
+
+    void NewGame(std::uint64_t seed) override
+    {
+      this->seed = seed;
+      this->first_move = true;
+      this->strategy->NewGame(seed);
+    }
+
+    fsweep::ButtonPosition GetMove(const fsweep::GameModel& game_model) override
+    {
+      std::lock_guard<std::mutex> lock(this->arena_log.mutex);
+      if (this->first_move)
+      {
+        this->arena_log.boards.emplace_back(this->seed, game_model.GetBoardHash());
+        this->first_move = false;
+      }
+      this->arena_log.move_count++;
+      return this->strategy->GetMove(game_model);
+    }
+  };
+
+  // clicks outside of the board, which forfeits every game on its first move
+  class ForfeitStrategy : public fsweep::Strategy
+  {
+   public:
+    fsweep::ButtonPosition GetMove(const fsweep::GameModel&) override
+    {
+      return fsweep::ButtonPosition(-1, -1);
+    }
+  };
+
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> getSortedBoards(ArenaLog& arena_log)
+  {
+    auto boards = arena_log.boards;
+    std::sort(boards.begin(), boards.end());
+    return boards;
+  }
+}  // namespace
+
+SCENARIO("An Arena plays every strategy on the same boards", "[arena]")
+{
+  GIVEN("An Arena with the rule, random and forfeit strategies on beginner boards")
+  {
+    const auto game_configuration = fsweep::GameConfiguration(fsweep::GameDifficulty::Beginner);
+    const std::uint64_t game_count = 32;
+    ArenaLog rule_log;
+    ArenaLog random_log;
+    fsweep::Arena arena;
+    arena.AddStrategy("rules",
+                      [&]
+                      {
+                        return std::make_unique<LoggingStrategy>(
+                            std::make_unique<fsweep::RuleStrategy>(), rule_log);
+                      });
+    arena.AddStrategy("random",
+                      [&]
+                      {
+                        return std::make_unique<LoggingStrategy>(
+                            std::make_unique<fsweep::RandomStrategy>(), random_log);
+                      });
+    arena.AddStrategy("forfeit", [] { return std::make_unique<ForfeitStrategy>(); });
+
+    WHEN("The games are played on 4 threads")
+    {
+      fsweep::ThreadPool thread_pool(4);
+      const auto results = arena.Run(game_configuration, game_count, 7, thread_pool);
+      REQUIRE(results.size() == 3);
+
+      THEN("Every strategy plays every game")
+      {
+        CHECK(results[0].name == "rules");
+        CHECK(results[1].name == "random");
+        CHECK(results[2].name == "forfeit");
+        for (const auto& result : results)
+        {
+          CHECK(result.game_count == game_count);
+          CHECK(result.win_count <= result.game_count);
+        }
+      }
+
+      THEN("Both strategies are given the same boards")
+      {
+        CHECK_FALSE(rule_log.boards.empty());
+        CHECK(getSortedBoards(rule_log) == getSortedBoards(random_log));
+      }
+
+      THEN("A move that is not a covered Button forfeits its game")
+      {
+        CHECK(results[0].forfeit_count == 0);
+        CHECK(results[1].forfeit_count == 0);
+        CHECK(results[2].forfeit_count == game_count);
+        CHECK(results[2].win_count == 0);
+        CHECK(results[2].move_count == game_count);
+      }
+
+      THEN("The moves of every game are merged into the results")
+      {
+        CHECK(results[0].move_count == rule_log.move_count);
+        CHECK(results[1].move_count == random_log.move_count);
+        for (const auto& result : results)
+        {
+          CHECK(result.move_histogram.GetCount() == result.move_count);
+        }
+      }
+
+      THEN("The same seed on a single thread gives the same results")
+      {
+        fsweep::ThreadPool single_thread_pool(1);
+        const auto single_results =
+            arena.Run(game_configuration, game_count, 7, single_thread_pool);
+        REQUIRE(single_results.size() == results.size());
+        for (std::size_t result_i = 0; result_i < results.size(); result_i++)
+        {
+          CHECK(single_results[result_i].game_count == results[result_i].game_count);
+          CHECK(single_results[result_i].win_count == results[result_i].win_count);
+          CHECK(single_results[result_i].forfeit_count == results[result_i].forfeit_count);
+          CHECK(single_results[result_i].move_count == results[result_i].move_count);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("An Arena plays the strategies of plugins", "[arena]")
+{
+  GIVEN("An Arena with the example plugin added twice")
+  {
+    fsweep::Arena arena;
+    arena.AddPlugin(FSWEEP_ARENA_EXAMPLE_PATH);
+    arena.AddPlugin(FSWEEP_ARENA_EXAMPLE_PATH);
+    REQUIRE(arena.GetStrategyCount() == 2);
+
+    WHEN("The games are played on 4 threads")
+    {
+      const std::uint64_t game_count = 16;
+      fsweep::ThreadPool thread_pool(4);
+      const auto results =
+          arena.Run(fsweep::GameConfiguration(fsweep::GameDifficulty::Beginner), game_count, 7,
+                    thread_pool);
+      REQUIRE(results.size() == 2);
+
+      THEN("Both plugins play every game the same way")
+      {
+        CHECK(results[0].name == std::filesystem::path(FSWEEP_ARENA_EXAMPLE_PATH).stem().string());
+        CHECK(results[1].name == results[0].name);
+        for (const auto& result : results)
+        {
+          CHECK(result.game_count == game_count);
+          CHECK(result.forfeit_count == 0);
+        }
+        CHECK(results[0].win_count == results[1].win_count);
+        CHECK(results[0].move_count == results[1].move_count);
+      }
+    }
+  }
+}
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <fsweep/BombOracle.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <limits>
+
+namespace
+{
+  std::uint64_t countBombs(const fsweep::BombOracle& bomb_oracle)
+  {
+    const auto game_configuration = bomb_oracle.GetGameConfiguration();
+    std::uint64_t bomb_count = 0;
+    for (int y = 0; y < game_configuration.GetButtonsTall(); y++)
+    {
+      for (int x = 0; x < game_configuration.GetButtonsWide(); x++)
+      {
+        if (bomb_oracle.HasBomb(x, y)) bomb_count++;
+      }
+    }
+    return bomb_count;
+  }
+}  // namespace
+
+SCENARIO("A BombOracle is constructed for a fixed bomb count")
+{
+  GIVEN("A BombOracle for beginner difficulty")
+  {
+    const fsweep::BombOracle bomb_oracle(fsweep::GameConfiguration(), 5);
+
+    THEN("The board has exactly the configured number of bombs")
+    {
+      CHECK(bomb_oracle.GetBombCount() == fsweep::GameConfiguration::BEGINNER_BOMB_COUNT);
+      CHECK(countBombs(bomb_oracle) == fsweep::GameConfiguration::BEGINNER_BOMB_COUNT);
+    }
+
+    THEN("The surrounding bombs of every Button match its neighbours")
+    {
+      for (int y = 0; y < fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL; y++)
+      {
+        for (int x = 0; x < fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE; x++)
+        {
+          int surrounding_bombs = 0;
+          for (int neighbour_y = y - 1; neighbour_y <= y + 1; neighbour_y++)
+          {
+            for (int neighbour_x = x - 1; neighbour_x <= x + 1; neighbour_x++)
+            {
+              if (neighbour_x < 0 || neighbour_y < 0) continue;
+              if (neighbour_x >= fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE) continue;
+              if (neighbour_y >= fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL) continue;
+              if (neighbour_x == x && neighbour_y == y) continue;
+              if (bomb_oracle.HasBomb(neighbour_x, neighbour_y)) surrounding_bombs++;
+            }
+          }
+          CHECK(bomb_oracle.GetButton(x, y).GetSurroundingBombs() == surrounding_bombs);
+          CHECK(bomb_oracle.GetButton(x, y).GetHasBomb() == bomb_oracle.HasBomb(x, y));
+        }
+      }
+    }
+  }
+
+  GIVEN("A BombOracle for a full board with an initial position")
+  {
+    const fsweep::BombOracle bomb_oracle(fsweep::GameConfiguration(8, 8, 64), 5, 2, 3);
+
+    THEN("Every Button except the initial position has a bomb")
+    {
+      CHECK(bomb_oracle.HasBomb(2, 3) == false);
+      CHECK(bomb_oracle.GetBombCount() == 63);
+      CHECK(countBombs(bomb_oracle) == 63);
+    }
+  }
+
+  GIVEN("A BombOracle for a 1000x1000 board with 200000 bombs and an initial position")
+  {
+    const fsweep::BombOracle bomb_oracle(fsweep::GameConfiguration(1000, 1000, 200000), 11, 500,
+                                         500);
+
+    THEN("The board has exactly 200000 bombs")
+    {
+      CHECK(bomb_oracle.HasBomb(500, 500) == false);
+      CHECK(countBombs(bomb_oracle) == 200000);
+    }
+  }
+
+  GIVEN("Two BombOracles with different seeds")
+  {
+    const fsweep::BombOracle a(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert), 1);
+    const fsweep::BombOracle b(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert), 2);
+
+    THEN("The bombs are in different places")
+    {
+      bool bombs_differ = false;
+      for (int y = 0; y < fsweep::GameConfiguration::EXPERT_BUTTONS_TALL; y++)
+      {
+        for (int x = 0; x < fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE; x++)
+        {
+          if (a.HasBomb(x, y) != b.HasBomb(x, y)) bombs_differ = true;
+        }
+      }
+      CHECK(bombs_differ);
+    }
+  }
+}
+
+SCENARIO("A BombOracle is queried with a bomb density")
+{
+  GIVEN("Bomb thresholds for a density of 0 and 1")
+  {
+    const auto empty_threshold = fsweep::BombOracle::GetBombThreshold(0);
+    const auto full_threshold = fsweep::BombOracle::GetBombThreshold(1);
+
+    THEN("The thresholds are the ends of the hash range")
+    {
+      CHECK(empty_threshold == 0);
+      CHECK(full_threshold == std::numeric_limits<std::uint64_t>::max());
+    }
+
+    THEN("No Button has a bomb with a density of 0")
+    {
+      for (std::int64_t x = -50; x < 50; x++)
+      {
+        CHECK(fsweep::BombOracle::HasBomb(3, x, -x, empty_threshold) == false);
+      }
+    }
+  }
+}
@@ -22,6 +22,8 @@
 
 #include <catch2/catch_all.hpp>
 #include <fsweep/Button.hpp>
+#include <string>
+#include <vector>
 
 SCENARIO("A Button is constructed with its default constructor")
 {
@@ -281,6 +283,33 @@ SCENARIO("The surrounding bombs of a button are set")
   }
 }
 
+SCENARIO("All state of a Button is packed together")
+{
+  GIVEN("A flagged Button with a bomb")
+  {
+    fsweep::Button button('c');
+
+    WHEN("The surrounding bombs of the Button are set to 8")
+    {
+      button.SetSurroundingBombs(8);
+
+      THEN("The Button is one byte") { CHECK(sizeof(button) == 1); }
+
+      THEN("The surrounding bombs of the Button are 8")
+      {
+        CHECK(button.GetSurroundingBombs() == 8);
+      }
+
+      THEN("The Button has a bomb") { CHECK(button.GetHasBomb() == true); }
+
+      THEN("The ButtonState is Flagged")
+      {
+        CHECK(button.GetButtonState() == fsweep::ButtonState::Flagged);
+      }
+    }
+  }
+}
+
 SCENARIO("A surrounding bombs are added to a Button")
 {
   GIVEN("A Button")
@@ -303,6 +332,26 @@ SCENARIO("A surrounding bombs are added to a Button")
   }
 }
 
+SCENARIO("A Button is marked as counted")
+{
+  GIVEN("A Button with 3 surrounding bombs")
+  {
+    fsweep::Button button;
+    button.SetSurroundingBombs(3);
+
+    THEN("The Button is not counted") { CHECK(button.GetIsCounted() == false); }
+
+    WHEN("The Button is marked as counted")
+    {
+      button.SetIsCounted(true);
+
+      THEN("The Button is counted") { CHECK(button.GetIsCounted() == true); }
+
+      THEN("The Button has 3 surrounding bombs") { CHECK(button.GetSurroundingBombs() == 3); }
+    }
+  }
+}
+
 SCENARIO("It is determined if a Button is pressable")
 {
   GIVEN("A Button")
@@ -333,4 +382,51 @@ SCENARIO("It is determined if a Button is pressable")
       THEN("The Button is pressable") { CHECK(button.GetIsPressable() == true); }
     }
   }
-}
\ No newline at end of file
+}
+
+SCENARIO("Buttons are converted to and from chars")
+{
+  GIVEN("A string with every Button char")
+  {
+    const std::string chars = "bdxfcqr.";
+
+    WHEN("The chars are converted to Buttons")
+    {
+      std::vector<fsweep::Button> buttons(chars.size());
+      fsweep::Button::FromChars(chars, buttons);
+
+      THEN("Each Button matches its char constructor")
+      {
+        for (std::size_t button_i = 0; button_i < chars.size(); button_i++)
+        {
+          const fsweep::Button button(chars[button_i]);
+          CHECK(buttons[button_i].GetButtonState() == button.GetButtonState());
+          CHECK(buttons[button_i].GetHasBomb() == button.GetHasBomb());
+        }
+      }
+
+      THEN("Each Button converts back to its char")
+      {
+        for (std::size_t button_i = 0; button_i < chars.size(); button_i++)
+        {
+          CHECK(buttons[button_i].ToChar() == chars[button_i]);
+        }
+      }
+
+      THEN("The Buttons convert back to the string")
+      {
+        std::string button_string(buttons.size(), ' ');
+        fsweep::Button::ToChars(buttons, button_string);
+        CHECK(button_string == chars);
+      }
+
+      THEN("The Buttons of each ButtonState are counted")
+      {
+        CHECK(fsweep::Button::CountButtonState(buttons, fsweep::ButtonState::None) == 2);
+        CHECK(fsweep::Button::CountButtonState(buttons, fsweep::ButtonState::Down) == 2);
+        CHECK(fsweep::Button::CountButtonState(buttons, fsweep::ButtonState::Flagged) == 2);
+        CHECK(fsweep::Button::CountButtonState(buttons, fsweep::ButtonState::Questioned) == 2);
+      }
+    }
+  }
+}
@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <fsweep/CounterRng.hpp>
+#include <fsweep/EndlessGameModel.hpp>
+
+SCENARIO("An EndlessGameModel is constructed")
+{
+  GIVEN("An EndlessGameModel with a bomb density below the minimum")
+  {
+    const fsweep::EndlessGameModel game_model(1, 0.01);
+
+    THEN("The bomb density is the minimum")
+    {
+      CHECK(game_model.GetBombDensity() == fsweep::EndlessGameModel::MIN_BOMB_DENSITY);
+    }
+
+    THEN("No chunks are allocated") { CHECK(game_model.GetChunkCount() == 0); }
+
+    THEN("The GameState is None") { CHECK(game_model.GetGameState() == fsweep::GameState::None); }
+  }
+
+  GIVEN("Two EndlessGameModels with the same seed")
+  {
+    const fsweep::EndlessGameModel a(42, fsweep::EndlessGameModel::DEFAULT_BOMB_DENSITY);
+    const fsweep::EndlessGameModel b(42, fsweep::EndlessGameModel::DEFAULT_BOMB_DENSITY);
+
+    THEN("Both have the same bombs")
+    {
+      for (std::int64_t y = -100; y < 100; y++)
+      {
+        for (std::int64_t x = -100; x < 100; x++)
+        {
+          REQUIRE(a.HasBomb(x, y) == b.HasBomb(x, y));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A Button of an EndlessGameModel is clicked")
+{
+  GIVEN("An EndlessGameModel")
+  {
+    fsweep::EndlessGameModel game_model(7, fsweep::EndlessGameModel::DEFAULT_BOMB_DENSITY);
+
+    WHEN("A Button far from the origin is clicked first")
+    {
+      const std::int64_t first_x = -1000000000000LL;
+      const std::int64_t first_y = 1000000000000LL;
+      game_model.ClickButton(first_x, first_y);
+
+      THEN("The GameState is Playing")
+      {
+        CHECK(game_model.GetGameState() == fsweep::GameState::Playing);
+      }
+
+      THEN("The Button has no bomb or surrounding bombs and is Down")
+      {
+        const auto button = game_model.GetButton(first_x, first_y);
+        CHECK(button.GetHasBomb() == false);
+        CHECK(button.GetSurroundingBombs() == 0);
+        CHECK(button.GetButtonState() == fsweep::ButtonState::Down);
+      }
+
+      THEN("At least the surrounding Buttons are pressed")
+      {
+        CHECK(game_model.GetButtonsPressed() >= 9);
+      }
+
+      THEN("Only chunks around the opening are allocated")
+      {
+        CHECK(game_model.GetChunkCount() > 0);
+        CHECK(game_model.GetChunkCount() < 64);
+      }
+
+      THEN("Every Button count matches the bombs around it")
+      {
+        for (std::int64_t y = first_y - 80; y < first_y + 80; y++)
+        {
+          for (std::int64_t x = first_x - 80; x < first_x + 80; x++)
+          {
+            int surrounding_bombs = 0;
+            for (std::int64_t neighbour_y = y - 1; neighbour_y <= y + 1; neighbour_y++)
+            {
+              for (std::int64_t neighbour_x = x - 1; neighbour_x <= x + 1; neighbour_x++)
+              {
+                if ((neighbour_x != x || neighbour_y != y) &&
+                    game_model.HasBomb(neighbour_x, neighbour_y))
+                {
+                  surrounding_bombs++;
+                }
+              }
+            }
+            REQUIRE(game_model.GetButton(x, y).GetHasBomb() == game_model.HasBomb(x, y));
+            REQUIRE(game_model.GetButton(x, y).GetSurroundingBombs() == surrounding_bombs);
+          }
+        }
+      }
+
+      WHEN("A Button with a bomb is clicked")
+      {
+        std::int64_t bomb_x = first_x + 10;
+        while (!game_model.HasBomb(bomb_x, first_y + 10))
+        {
+          bomb_x++;
+        }
+        game_model.ClickButton(bomb_x, first_y + 10);
+
+        THEN("The GameState is Dead")
+        {
+          CHECK(game_model.GetGameState() == fsweep::GameState::Dead);
+        }
+
+        WHEN("A new game is started")
+        {
+          game_model.NewGame();
+
+          THEN("No chunks are allocated") { CHECK(game_model.GetChunkCount() == 0); }
+
+          THEN("The GameState is None")
+          {
+            CHECK(game_model.GetGameState() == fsweep::GameState::None);
+          }
+        }
+      }
+    }
+
+    WHEN("A Button is flagged and then a Button next to it is clicked first")
+    {
+      game_model.AltClickButton(1, 0);
+      game_model.ClickButton(0, 0);
+
+      THEN("The flagged Button has no bomb")
+      {
+        CHECK(game_model.GetButton(1, 0).GetHasBomb() == false);
+      }
+
+      THEN("The flag count is 1") { CHECK(game_model.GetFlagCount() == 1); }
+
+      THEN("The flagged Button is still Flagged")
+      {
+        CHECK(game_model.GetButton(1, 0).GetButtonState() == fsweep::ButtonState::Flagged);
+      }
+    }
+  }
+}
+
+SCENARIO("Values are generated by a CounterRng")
+{
+  GIVEN("A seed and a counter")
+  {
+    THEN("The same seed and counter always give the same value")
+    {
+      CHECK(fsweep::CounterRng::Get(3, 5) == fsweep::CounterRng::Get(3, 5));
+      CHECK(fsweep::CounterRng::Get(3, 5, 7) == fsweep::CounterRng::Get(3, 5, 7));
+    }
+
+    THEN("Different counters give different values")
+    {
+      CHECK(fsweep::CounterRng::Get(3, 5) != fsweep::CounterRng::Get(3, 6));
+      CHECK(fsweep::CounterRng::Get(3, 5, 7) != fsweep::CounterRng::Get(3, 7, 5));
+    }
+  }
+}
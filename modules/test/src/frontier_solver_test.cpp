@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/FrontierSolver.hpp>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace
+{
+  std::vector<std::size_t> getSorted(std::span<const std::size_t> button_is)
+  {
+    std::vector<std::size_t> sorted_button_is(button_is.begin(), button_is.end());
+    std::sort(sorted_button_is.begin(), sorted_button_is.end());
+    return sorted_button_is;
+  }
+}  // namespace
+
+SCENARIO("A FrontierSolver decides Buttons from all constraints together", "[FrontierSolver]")
+{
+  GIVEN("A FrontierSolver with a chain of constraints where no constraint is within another")
+  {
+    // a + b = 1, b + c = 1 and c + d = 1 give a + d = 1, which leaves e
+    fsweep::FrontierSolver frontier_solver;
+    frontier_solver.AddConstraint(std::vector<std::size_t>{10, 11}, 1);
+    frontier_solver.AddConstraint(std::vector<std::size_t>{11, 12}, 1);
+    frontier_solver.AddConstraint(std::vector<std::size_t>{12, 13}, 1);
+
+    WHEN("The last constraint has one bomb")
+    {
+      frontier_solver.AddConstraint(std::vector<std::size_t>{10, 13, 14}, 1);
+      frontier_solver.Solve();
+
+      THEN("The Button outside the chain is safe")
+      {
+        CHECK(getSorted(frontier_solver.GetSafeButtons()) == std::vector<std::size_t>{14});
+        CHECK(frontier_solver.GetBombButtons().empty());
+      }
+    }
+
+    WHEN("The last constraint has two bombs")
+    {
+      frontier_solver.AddConstraint(std::vector<std::size_t>{10, 13, 14}, 2);
+      frontier_solver.Solve();
+
+      THEN("The Button outside the chain has a bomb")
+      {
+        CHECK(frontier_solver.GetSafeButtons().empty());
+        CHECK(getSorted(frontier_solver.GetBombButtons()) == std::vector<std::size_t>{14});
+      }
+    }
+
+    WHEN("A separate constraint is full")
+    {
+      frontier_solver.AddConstraint(std::vector<std::size_t>{20, 21}, 2);
+      frontier_solver.AddConstraint(std::vector<std::size_t>{21, 22}, 1);
+      frontier_solver.Solve();
+
+      THEN("Its Buttons are decided on their own")
+      {
+        CHECK(getSorted(frontier_solver.GetSafeButtons()) == std::vector<std::size_t>{22});
+        CHECK(getSorted(frontier_solver.GetBombButtons()) == std::vector<std::size_t>{20, 21});
+      }
+    }
+
+    WHEN("The solver is cleared")
+    {
+      frontier_solver.Clear();
+      frontier_solver.Solve();
+
+      THEN("Nothing is decided")
+      {
+        CHECK(frontier_solver.GetSafeButtons().empty());
+        CHECK(frontier_solver.GetBombButtons().empty());
+      }
+    }
+  }
+
+  GIVEN("Random constraints over a few Buttons with hidden bombs")
+  {
+    const std::size_t button_count = 12;
+    std::mt19937 rng(7);
+
+    THEN("Every decided Button agrees with every arrangement that satisfies the constraints")
+    {
+      for (int round_i = 0; round_i < 200; round_i++)
+      {
+        const auto bombs = static_cast<std::uint32_t>(rng() & ((1u << button_count) - 1));
+        std::vector<std::vector<std::size_t>> constraints;
+        std::vector<int> bomb_counts;
+        fsweep::FrontierSolver frontier_solver;
+        for (int constraint_i = 0; constraint_i < 8; constraint_i++)
+        {
+          std::vector<std::size_t> button_is;
+          int bomb_count = 0;
+          for (std::size_t button_i = 0; button_i < button_count; button_i++)
+          {
+            if (rng() % 4 != 0) continue;
+            button_is.push_back(button_i);
+            bomb_count += (bombs >> button_i) & 1;
+          }
+          frontier_solver.AddConstraint(button_is, bomb_count);
+          constraints.push_back(button_is);
+          bomb_counts.push_back(bomb_count);
+        }
+        frontier_solver.Solve();
+        for (std::uint32_t arrangement = 0; arrangement < (1u << button_count); arrangement++)
+        {
+          bool satisfies = true;
+          for (std::size_t constraint_i = 0; constraint_i < constraints.size(); constraint_i++)
+          {
+            int bomb_count = 0;
+            for (const auto button_i : constraints[constraint_i])
+            {
+              bomb_count += (arrangement >> button_i) & 1;
+            }
+            satisfies = satisfies && bomb_count == bomb_counts[constraint_i];
+          }
+          if (!satisfies) continue;
+          for (const auto button_i : frontier_solver.GetSafeButtons())
+          {
+            REQUIRE(((arrangement >> button_i) & 1) == 0);
+          }
+          for (const auto button_i : frontier_solver.GetBombButtons())
+          {
+            REQUIRE(((arrangement >> button_i) & 1) == 1);
+          }
+        }
+      }
+    }
+  }
+}
@@ -379,4 +379,30 @@ SCENARIO("Two GameConfiguration objects are compared")
       THEN("a is not equal to b") { CHECK(a != b); }
     }
   }
-}
\ No newline at end of file
+}
+
+SCENARIO("A GameConfiguration is constructed with huge dimensions")
+{
+  GIVEN("A GameConfiguration created with 50000x50000 dimensions and 10 bombs")
+  {
+    const fsweep::GameConfiguration game_configuration(50000, 50000, 10);
+
+    THEN("The button count does not overflow")
+    {
+      CHECK(game_configuration.GetButtonCount() == 2500000000ULL);
+    }
+  }
+
+  GIVEN("A GameConfiguration created with dimensions above the maximum")
+  {
+    const fsweep::GameConfiguration game_configuration(
+        fsweep::GameConfiguration::MAX_BUTTONS_WIDE + 1,
+        fsweep::GameConfiguration::MAX_BUTTONS_TALL + 1, 10);
+
+    THEN("The dimensions are the maximum")
+    {
+      CHECK(game_configuration.GetButtonsWide() == fsweep::GameConfiguration::MAX_BUTTONS_WIDE);
+      CHECK(game_configuration.GetButtonsTall() == fsweep::GameConfiguration::MAX_BUTTONS_TALL);
+    }
+  }
+}
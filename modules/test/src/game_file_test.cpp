@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fsweep/GameFile.hpp>
+#include <fsweep/GameModel.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  std::vector<std::uint8_t> writeGameFile(const fsweep::GameModel& game_model)
+  {
+    std::ostringstream stream;
+    fsweep::GameFile::Write(game_model, stream);
+    const auto data = stream.str();
+    return std::vector<std::uint8_t>(data.begin(), data.end());
+  }
+
+  void checkSameGame(const fsweep::GameModel& a, const fsweep::GameModel& b)
+  {
+    CHECK(a.GetGameConfiguration() == b.GetGameConfiguration());
+    CHECK(a.GetGameState() == b.GetGameState());
+    CHECK(a.GetGameTime() == b.GetGameTime());
+    CHECK(a.GetQuestionsEnabled() == b.GetQuestionsEnabled());
+    CHECK(a.GetSeed() == b.GetSeed());
+    CHECK(a.GetFlagCount() == b.GetFlagCount());
+    CHECK(a.GetButtonsLeft() == b.GetButtonsLeft());
+    const auto& a_buttons = a.GetButtons();
+    const auto& b_buttons = b.GetButtons();
+    REQUIRE(a_buttons.size() == b_buttons.size());
+    for (std::size_t button_i = 0; button_i < a_buttons.size(); button_i++)
+    {
+      REQUIRE(a_buttons[button_i].GetButtonState() == b_buttons[button_i].GetButtonState());
+      REQUIRE(a_buttons[button_i].GetHasBomb() == b_buttons[button_i].GetHasBomb());
+      REQUIRE(a_buttons[button_i].GetSurroundingBombs() ==
+              b_buttons[button_i].GetSurroundingBombs());
+    }
+  }
+}  // namespace
+
+SCENARIO("A GameModel is saved to and loaded from a GameFile")
+{
+  GIVEN("A GameModel with a 37x23 board that is being played")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(37, 23, 100));
+    game_model.SetSeed(321);
+    game_model.SetQuestionsEnabled(true);
+    game_model.ClickButton(10, 10);
+    game_model.AltClickButton(0, 0);
+    game_model.AltClickButton(36, 22);
+    game_model.AltClickButton(36, 22);
+    game_model.UpdateTime(4321);
+
+    WHEN("The GameModel is written to memory")
+    {
+      const auto data = writeGameFile(game_model);
+
+      THEN("The GameFile has a header and 3 bits per Button")
+      {
+        CHECK(data.size() == fsweep::GameFile::HEADER_SIZE + ((37 * 23) + 7) / 8 +
+                                 ((37 * 23) + 3) / 4);
+      }
+
+      THEN("The GameModel read back is the same")
+      {
+        const auto read_model = fsweep::GameFile::Read(data);
+        checkSameGame(game_model, *read_model);
+      }
+
+      THEN("A GameFile with a newer version can not be read")
+      {
+        auto newer_data = data;
+        newer_data[4] = fsweep::GameFile::VERSION + 1;
+        CHECK_THROWS_AS(fsweep::GameFile::Read(newer_data), std::runtime_error);
+      }
+
+      THEN("A GameFile with the wrong magic can not be read")
+      {
+        auto wrong_data = data;
+        wrong_data[0] = 'X';
+        CHECK_THROWS_AS(fsweep::GameFile::Read(wrong_data), std::runtime_error);
+      }
+
+      THEN("A truncated GameFile can not be read")
+      {
+        auto truncated_data = data;
+        truncated_data.pop_back();
+        CHECK_THROWS_AS(fsweep::GameFile::Read(truncated_data), std::runtime_error);
+      }
+    }
+
+    WHEN("The GameModel is written to a file and the file is mapped")
+    {
+      const auto path =
+          (std::filesystem::temp_directory_path() / "fsweep_game_file_test.fsweep").string();
+      fsweep::GameFile::Write(game_model, path);
+      const auto read_model = fsweep::GameFile::Read(path);
+      std::remove(path.c_str());
+
+      THEN("The GameModel read back is the same") { checkSameGame(game_model, *read_model); }
+    }
+  }
+
+  GIVEN("A path that does not exist")
+  {
+    const auto path =
+        (std::filesystem::temp_directory_path() / "fsweep_game_file_test_missing.fsweep").string();
+
+    THEN("The GameFile can not be read")
+    {
+      CHECK_THROWS_AS(fsweep::GameFile::Read(path), std::runtime_error);
+    }
+  }
+}
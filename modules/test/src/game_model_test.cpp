@@ -20,8 +20,13 @@
  *
  */
 
+#include <algorithm>
 #include <catch2/catch_all.hpp>
 #include <fsweep/GameModel.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <string>
+#include <utility>
+#include <vector>
 
 SCENARIO("A GameModel is constructed with its default constructor")
 {
@@ -139,6 +144,18 @@ SCENARIO("A GameModel is constructed with its overloaded constructor")
     }
 
     THEN("The flag count is 2") { CHECK(game_model.GetFlagCount() == 2); }
+
+    THEN("The button string is the string the GameModel was constructed with")
+    {
+      CHECK(game_model.ToButtonString() == "dbxfcqr."
+                                           "........"
+                                           "........"
+                                           "........"
+                                           "........"
+                                           "........"
+                                           "........"
+                                           "........");
+    }
   }
 }
 
@@ -268,6 +285,125 @@ SCENARIO("A new game is started in a GameModel with a configuration change")
   }
 }
 
+SCENARIO("A new game is started in a GameModel with a huge configuration")
+{
+  GIVEN("A GameModel with beginner difficulty")
+  {
+    fsweep::GameModel game_model;
+
+    THEN("The memory estimate of beginner difficulty is within the maximum")
+    {
+      CHECK(fsweep::GameModel::GetMemoryEstimate(fsweep::GameConfiguration()) <=
+            fsweep::GameModel::MAX_MEMORY_ESTIMATE);
+    }
+
+    WHEN("A new game with 50000x50000 dimensions is started")
+    {
+      const fsweep::GameConfiguration game_configuration(50000, 50000, 10);
+
+      THEN("The memory estimate is above the maximum")
+      {
+        CHECK(fsweep::GameModel::GetMemoryEstimate(game_configuration) >
+              fsweep::GameModel::MAX_MEMORY_ESTIMATE);
+      }
+
+      THEN("An exception is thrown and the GameModel is unchanged")
+      {
+        CHECK_THROWS_AS(game_model.NewGame(game_configuration), std::runtime_error);
+        CHECK(game_model.GetGameConfiguration() == fsweep::GameConfiguration());
+        CHECK(game_model.GetButtons().size() == 64);
+      }
+    }
+
+    WHEN("A new game with 20000x20000 dimensions is started with frontier tracking")
+    {
+      const fsweep::GameConfiguration game_configuration(20000, 20000, 10);
+      game_model.SetFrontierTracking(true);
+
+      THEN("The memory estimate is only above the maximum with frontier tracking")
+      {
+        CHECK(fsweep::GameModel::GetMemoryEstimate(game_configuration) <=
+              fsweep::GameModel::MAX_MEMORY_ESTIMATE);
+        CHECK(fsweep::GameModel::GetMemoryEstimate(game_configuration, true) >
+              fsweep::GameModel::MAX_MEMORY_ESTIMATE);
+      }
+
+      THEN("An exception is thrown and the GameModel is unchanged")
+      {
+        CHECK_THROWS_AS(game_model.NewGame(game_configuration), std::runtime_error);
+        CHECK(game_model.GetGameConfiguration() == fsweep::GameConfiguration());
+        CHECK(game_model.GetFrontierTracking());
+      }
+    }
+  }
+}
+
+SCENARIO("Many new games are started in a GameModel")
+{
+  GIVEN("A GameModel with beginner difficulty")
+  {
+    fsweep::GameModel game_model;
+
+    WHEN("More new games than the button epoch can count are played and restarted")
+    {
+      for (int game_i = 0; game_i < 300; game_i++)
+      {
+        game_model.AltClickButton(game_i % 8, 0);
+        game_model.ClickButton(7, 7);
+        game_model.NewGame();
+      }
+
+      THEN("Every Button is default constructed")
+      {
+        for (int y = 0; y < 8; y++)
+        {
+          for (int x = 0; x < 8; x++)
+          {
+            CHECK(game_model.GetButton(x, y).GetButtonState() == fsweep::ButtonState::None);
+            CHECK(game_model.GetButton(x, y).GetHasBomb() == false);
+          }
+        }
+        for (const auto& button : game_model.GetButtons())
+        {
+          CHECK(button.GetButtonState() == fsweep::ButtonState::None);
+          CHECK(button.GetHasBomb() == false);
+          CHECK(button.GetSurroundingBombs() == 0);
+        }
+      }
+
+      THEN("The flag count is 0") { CHECK(game_model.GetFlagCount() == 0); }
+    }
+  }
+
+  GIVEN("A GameModel with expert difficulty that has been played")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.ClickButton(0, 0);
+    const auto expert_capacity = game_model.GetButtons().capacity();
+
+    WHEN("A new game is started with beginner difficulty and then expert difficulty again")
+    {
+      game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Beginner));
+      game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+
+      THEN("The Button storage is reused")
+      {
+        CHECK(game_model.GetButtons().capacity() == expert_capacity);
+      }
+
+      THEN("Every Button is default constructed")
+      {
+        for (const auto& button : game_model.GetButtons())
+        {
+          CHECK(button.GetButtonState() == fsweep::ButtonState::None);
+          CHECK(button.GetHasBomb() == false);
+        }
+      }
+    }
+  }
+}
+
 SCENARIO("A Button of a GameModel is clicked")
 {
   GIVEN("A default constructed GameModel")
@@ -452,6 +588,843 @@ SCENARIO("A Button of a GameModel is clicked")
   }
 }
 
+SCENARIO("Surrounding bombs are counted lazily in a GameModel")
+{
+  GIVEN("A GameModel with a 100x100 board, 2000 bombs and lazy counting")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(100, 100, 2000));
+    game_model.SetLazyCounting(true);
+
+    THEN("Lazy counting is enabled") { CHECK(game_model.GetLazyCounting() == true); }
+
+    WHEN("A Button is clicked")
+    {
+      game_model.ClickButton(50, 50);
+
+      THEN("Every Button has the same count as its neighbouring bombs")
+      {
+        for (int y = 0; y < 100; y++)
+        {
+          for (int x = 0; x < 100; x++)
+          {
+            int surrounding_bombs = 0;
+            for (int neighbour_y = y - 1; neighbour_y <= y + 1; neighbour_y++)
+            {
+              for (int neighbour_x = x - 1; neighbour_x <= x + 1; neighbour_x++)
+              {
+                if (neighbour_x < 0 || neighbour_y < 0 || neighbour_x >= 100 || neighbour_y >= 100)
+                  continue;
+                if (neighbour_x == x && neighbour_y == y) continue;
+                if (game_model.GetButton(neighbour_x, neighbour_y).GetHasBomb())
+                  surrounding_bombs++;
+              }
+            }
+            REQUIRE(game_model.GetButton(x, y).GetSurroundingBombs() == surrounding_bombs);
+          }
+        }
+      }
+
+      WHEN("Lazy counting is disabled")
+      {
+        game_model.SetLazyCounting(false);
+
+        THEN("Every Button is counted")
+        {
+          for (const auto& button : game_model.GetButtons())
+          {
+            REQUIRE(button.GetIsCounted() == true);
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A GameModel is seeded")
+{
+  GIVEN("Two GameModels with expert difficulty and the same seed")
+  {
+    fsweep::GameModel a;
+    fsweep::GameModel b;
+    a.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    b.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    a.SetSeed(1234);
+    b.SetSeed(1234);
+
+    THEN("Both have the seed") { CHECK(a.GetSeed() == 1234); }
+
+    WHEN("The same Button is clicked in both")
+    {
+      a.ClickButton(3, 3);
+      b.ClickButton(3, 3);
+
+      THEN("Both have the same bombs")
+      {
+        for (int y = 0; y < fsweep::GameConfiguration::EXPERT_BUTTONS_TALL; y++)
+        {
+          for (int x = 0; x < fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE; x++)
+          {
+            REQUIRE(a.GetButton(x, y).GetHasBomb() == b.GetButton(x, y).GetHasBomb());
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A GameModel is cloned and forked")
+{
+  GIVEN("An expert GameModel with a journal and a seed that has not been clicked")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetSeed(42);
+    game_model.SetJournalCapacity(16, 1024);
+    game_model.AltClickButton(0, 0);
+
+    WHEN("The GameModel is cloned and the same Button is clicked in both")
+    {
+      auto clone = game_model.Clone();
+      game_model.ClickButton(15, 8);
+      clone.ClickButton(15, 8);
+
+      THEN("Both have the same game")
+      {
+        CHECK(clone.GetSeed() == game_model.GetSeed());
+        CHECK(clone.GetGameState() == game_model.GetGameState());
+        CHECK(clone.GetFlagCount() == game_model.GetFlagCount());
+        CHECK(clone.ToButtonString() == game_model.ToButtonString());
+      }
+
+      THEN("Only the GameModel has a journal")
+      {
+        CHECK(game_model.GetCanUndo() == true);
+        CHECK(clone.GetCanUndo() == false);
+      }
+
+      THEN("A Button clicked in the clone is not clicked in the GameModel")
+      {
+        const auto button_string = game_model.ToButtonString();
+        clone.AltClickButton(29, 15);
+        clone.AltClickButton(29, 0);
+        CHECK(game_model.ToButtonString() == button_string);
+        CHECK(clone.ToButtonString() != button_string);
+      }
+    }
+
+    WHEN("The GameModel is forked twice with the same and once with another fork index")
+    {
+      auto fork_a = game_model.Fork(1);
+      auto fork_b = game_model.Fork(1);
+      auto fork_c = game_model.Fork(2);
+      fork_a.ClickButton(15, 8);
+      fork_b.ClickButton(15, 8);
+      fork_c.ClickButton(15, 8);
+
+      THEN("The forks with the same fork index have the same bombs")
+      {
+        CHECK(fork_a.ToButtonString() == fork_b.ToButtonString());
+      }
+
+      THEN("The fork with another fork index has other bombs")
+      {
+        CHECK(fork_a.ToButtonString() != fork_c.ToButtonString());
+      }
+
+      THEN("The forks keep the Buttons of the GameModel")
+      {
+        CHECK(fork_a.GetButton(0, 0).GetButtonState() == fsweep::ButtonState::Flagged);
+      }
+    }
+
+    WHEN("A clone is moved and assigned")
+    {
+      auto clone = game_model.Clone();
+      fsweep::GameModel moved_clone = std::move(clone);
+      fsweep::GameModel assigned_clone;
+      assigned_clone = moved_clone;
+
+      THEN("Both have the game of the GameModel")
+      {
+        CHECK(moved_clone.ToButtonString() == game_model.ToButtonString());
+        CHECK(assigned_clone.ToButtonString() == game_model.ToButtonString());
+        CHECK(assigned_clone.GetSeed() == 42);
+      }
+    }
+  }
+}
+
+SCENARIO("A huge GameModel is played with different numbers of threads")
+{
+  GIVEN("Two GameModels with a 1100x1000 board, 200000 bombs and the same seed")
+  {
+    const int buttons_wide = 1100;
+    const int buttons_tall = 1000;
+    fsweep::ThreadPool serial_thread_pool(1);
+    fsweep::ThreadPool parallel_thread_pool(4);
+    fsweep::GameModel serial_model;
+    fsweep::GameModel parallel_model;
+    serial_model.NewGame(fsweep::GameConfiguration(buttons_wide, buttons_tall, 200000));
+    parallel_model.NewGame(fsweep::GameConfiguration(buttons_wide, buttons_tall, 200000));
+    serial_model.SetSeed(99);
+    parallel_model.SetSeed(99);
+    serial_model.SetThreadPool(serial_thread_pool);
+    parallel_model.SetThreadPool(parallel_thread_pool);
+
+    THEN("The board is above the parallel size")
+    {
+      CHECK(serial_model.GetGameConfiguration().GetButtonCount() >=
+            fsweep::GameModel::PARALLEL_BUTTON_COUNT);
+    }
+
+    WHEN("The same Button is clicked in both")
+    {
+      serial_model.ClickButton(500, 500);
+      parallel_model.ClickButton(500, 500);
+
+      THEN("Both boards are identical")
+      {
+        const auto& serial_buttons = serial_model.GetButtons();
+        const auto& parallel_buttons = parallel_model.GetButtons();
+        REQUIRE(serial_buttons.size() == parallel_buttons.size());
+        for (std::size_t button_i = 0; button_i < serial_buttons.size(); button_i++)
+        {
+          REQUIRE(serial_buttons[button_i].GetHasBomb() ==
+                  parallel_buttons[button_i].GetHasBomb());
+          REQUIRE(serial_buttons[button_i].GetSurroundingBombs() ==
+                  parallel_buttons[button_i].GetSurroundingBombs());
+          REQUIRE(serial_buttons[button_i].GetButtonState() ==
+                  parallel_buttons[button_i].GetButtonState());
+        }
+      }
+
+      THEN("The board has exactly 200000 bombs and counts that match them")
+      {
+        int bomb_count = 0;
+        for (int y = 0; y < buttons_tall; y++)
+        {
+          for (int x = 0; x < buttons_wide; x++)
+          {
+            if (parallel_model.GetButton(x, y).GetHasBomb()) bomb_count++;
+            int surrounding_bombs = 0;
+            for (int neighbour_y = std::max(y - 1, 0);
+                 neighbour_y <= std::min(y + 1, buttons_tall - 1); neighbour_y++)
+            {
+              for (int neighbour_x = std::max(x - 1, 0);
+                   neighbour_x <= std::min(x + 1, buttons_wide - 1); neighbour_x++)
+              {
+                if ((neighbour_x != x || neighbour_y != y) &&
+                    parallel_model.GetButton(neighbour_x, neighbour_y).GetHasBomb())
+                {
+                  surrounding_bombs++;
+                }
+              }
+            }
+            REQUIRE(parallel_model.GetButton(x, y).GetSurroundingBombs() == surrounding_bombs);
+          }
+        }
+        CHECK(bomb_count == 200000);
+        CHECK(parallel_model.GetGameState() == fsweep::GameState::Playing);
+      }
+    }
+  }
+}
+
+SCENARIO("A huge opening is flood filled in parallel")
+{
+  GIVEN("GameModels with a 1100x1000 board, 2000 bombs and the same seed")
+  {
+    const fsweep::GameConfiguration game_configuration(1100, 1000, 2000);
+    fsweep::ThreadPool serial_thread_pool(1);
+    fsweep::ThreadPool parallel_thread_pool(4);
+    fsweep::GameModel sequential_model;
+    fsweep::GameModel serial_model;
+    fsweep::GameModel parallel_model;
+    for (auto* game_model : {&sequential_model, &serial_model, &parallel_model})
+    {
+      game_model->NewGame(game_configuration);
+      game_model->SetSeed(7);
+    }
+    // lazy counting keeps the flood fill on a single thread walking the stack
+    sequential_model.SetLazyCounting(true);
+    serial_model.SetThreadPool(serial_thread_pool);
+    parallel_model.SetThreadPool(parallel_thread_pool);
+
+    WHEN("A flag is placed and the same Button is clicked in each")
+    {
+      for (auto* game_model : {&sequential_model, &serial_model, &parallel_model})
+      {
+        game_model->AltClickButton(600, 600);
+        game_model->ClickButton(550, 500);
+      }
+
+      THEN("The opening is large enough to be filled in parallel")
+      {
+        CHECK(static_cast<std::size_t>(game_configuration.GetButtonCount() -
+                                       game_configuration.GetBombCount() -
+                                       parallel_model.GetButtonsLeft()) >=
+              fsweep::GameModel::PARALLEL_FLOOD_FILL_COUNT);
+      }
+
+      THEN("Every GameModel has the same buttons left")
+      {
+        CHECK(serial_model.GetButtonsLeft() == sequential_model.GetButtonsLeft());
+        CHECK(parallel_model.GetButtonsLeft() == sequential_model.GetButtonsLeft());
+      }
+
+      THEN("Every GameModel has the same ButtonStates")
+      {
+        const auto& sequential_buttons = sequential_model.GetButtons();
+        const auto& serial_buttons = serial_model.GetButtons();
+        const auto& parallel_buttons = parallel_model.GetButtons();
+        for (std::size_t button_i = 0; button_i < sequential_buttons.size(); button_i++)
+        {
+          REQUIRE(serial_buttons[button_i].GetButtonState() ==
+                  sequential_buttons[button_i].GetButtonState());
+          REQUIRE(parallel_buttons[button_i].GetButtonState() ==
+                  sequential_buttons[button_i].GetButtonState());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Actions are undone and redone in a GameModel")
+{
+  GIVEN("An expert GameModel with questions and a journal")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetQuestionsEnabled(true);
+    game_model.SetSeed(5);
+    game_model.SetJournalCapacity(1024, 1 << 16);
+    const auto new_game_string = game_model.ToButtonString();
+    const auto get_snapshot = [&]()
+    {
+      return game_model.ToButtonString() +
+             std::to_string(static_cast<int>(game_model.GetGameState())) + "/" +
+             std::to_string(game_model.GetFlagCount()) + "/" +
+             std::to_string(game_model.GetButtonsLeft());
+    };
+
+    THEN("There is nothing to undo or redo")
+    {
+      CHECK(game_model.GetCanUndo() == false);
+      CHECK(game_model.GetCanRedo() == false);
+      CHECK(game_model.Undo() == false);
+      CHECK(game_model.Redo() == false);
+    }
+
+    WHEN("The first click is undone")
+    {
+      game_model.ClickButton(15, 8);
+      const auto clicked_snapshot = get_snapshot();
+      CHECK(game_model.Undo() == true);
+
+      THEN("The bombs are removed and the game has not started")
+      {
+        CHECK(game_model.GetGameState() == fsweep::GameState::None);
+        CHECK(game_model.ToButtonString() == new_game_string);
+        CHECK(game_model.GetCanUndo() == false);
+        CHECK(game_model.GetCanRedo() == true);
+      }
+
+      THEN("Redoing the first click places the same bombs")
+      {
+        CHECK(game_model.Redo() == true);
+        CHECK(get_snapshot() == clicked_snapshot);
+      }
+
+      THEN("A new action can not be redone")
+      {
+        game_model.AltClickButton(0, 0);
+        CHECK(game_model.GetCanRedo() == false);
+      }
+    }
+
+    WHEN("The first click is followed by clicks that change nothing")
+    {
+      game_model.ClickButton(15, 8);
+      game_model.AltClickButton(15, 8);
+      game_model.ClickButton(15, 8);
+
+      THEN("The next undo undoes the first click")
+      {
+        CHECK(game_model.Undo() == true);
+        CHECK(game_model.GetGameState() == fsweep::GameState::None);
+        CHECK(game_model.GetCanUndo() == false);
+      }
+    }
+
+    WHEN("An alt click is undone and a revealed Button is clicked")
+    {
+      game_model.ClickButton(15, 8);
+      int covered_x = 0;
+      int covered_y = 0;
+      while (game_model.GetButton(covered_x, covered_y).GetButtonState() !=
+             fsweep::ButtonState::None)
+      {
+        covered_x++;
+        if (covered_x == fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE)
+        {
+          covered_x = 0;
+          covered_y++;
+        }
+      }
+      game_model.AltClickButton(covered_x, covered_y);
+      CHECK(game_model.Undo() == true);
+      game_model.ClickButton(15, 8);
+
+      THEN("The alt click can still be redone")
+      {
+        CHECK(game_model.GetCanRedo() == true);
+        CHECK(game_model.Redo() == true);
+        CHECK(game_model.GetButton(covered_x, covered_y).GetButtonState() ==
+              fsweep::ButtonState::Flagged);
+      }
+    }
+
+    WHEN("Clicks that change nothing are made with an action listener")
+    {
+      std::vector<fsweep::GameAction> game_actions;
+      game_model.SetActionListener([&](fsweep::GameAction game_action, int, int)
+                                   { game_actions.push_back(game_action); });
+      game_model.ClickButton(15, 8);
+      game_model.ClickButton(15, 8);
+      game_model.AltClickButton(15, 8);
+      game_model.AreaClickButton(15, 8);
+      int covered_x = 0;
+      while (game_model.GetButton(covered_x, 0).GetButtonState() != fsweep::ButtonState::None)
+      {
+        covered_x++;
+      }
+      game_model.AltClickButton(covered_x, 0);
+      game_model.ClickButton(covered_x, 0);
+
+      THEN("The listener is only told about the clicks that change the game")
+      {
+        CHECK(game_actions == std::vector<fsweep::GameAction>{fsweep::GameAction::Click,
+                                                              fsweep::GameAction::AltClick});
+      }
+    }
+
+    WHEN("A click is undone with an action listener")
+    {
+      std::vector<fsweep::GameAction> game_actions;
+      game_model.SetActionListener([&](fsweep::GameAction game_action, int, int)
+                                   { game_actions.push_back(game_action); });
+      game_model.ClickButton(15, 8);
+
+      THEN("The click can not be undone while the listener is set")
+      {
+        CHECK(game_model.GetCanUndo() == false);
+        CHECK(game_model.Undo() == false);
+        CHECK(game_model.GetGameState() == fsweep::GameState::Playing);
+        CHECK(game_actions == std::vector<fsweep::GameAction>{fsweep::GameAction::Click});
+      }
+
+      THEN("The click can be undone once the listener is removed, but not redone while it is set")
+      {
+        game_model.SetActionListener(nullptr);
+        CHECK(game_model.Undo() == true);
+        game_model.SetActionListener([&](fsweep::GameAction game_action, int, int)
+                                     { game_actions.push_back(game_action); });
+        CHECK(game_model.GetCanRedo() == false);
+        CHECK(game_model.Redo() == false);
+        CHECK(game_model.GetGameState() == fsweep::GameState::None);
+      }
+    }
+
+    WHEN("A game is played and every action is undone and redone")
+    {
+      std::vector<std::string> snapshots = {get_snapshot()};
+      for (int alt_click_i = 0; alt_click_i < 3; alt_click_i++)
+      {
+        game_model.AltClickButton(0, 0);
+        snapshots.push_back(get_snapshot());
+      }
+      game_model.ClickButton(15, 8);
+      snapshots.push_back(get_snapshot());
+      const auto& buttons = game_model.GetButtons();
+      for (std::size_t button_i = 0; button_i < buttons.size(); button_i++)
+      {
+        if (buttons[button_i].GetHasBomb())
+        {
+          game_model.AltClickButton(
+              static_cast<int>(button_i % fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE),
+              static_cast<int>(button_i / fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE));
+          snapshots.push_back(get_snapshot());
+        }
+      }
+      // with every bomb flagged, every pressed Button can be area clicked
+      for (int y = 0; y < fsweep::GameConfiguration::EXPERT_BUTTONS_TALL; y++)
+      {
+        for (int x = 0; x < fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE; x++)
+        {
+          if (game_model.GetGameState() != fsweep::GameState::Playing) break;
+          const auto& button = game_model.GetButton(x, y);
+          if (button.GetButtonState() == fsweep::ButtonState::Down)
+          {
+            // an area click that presses nothing is not journaled
+            game_model.AreaClickButton(x, y);
+            if (get_snapshot() != snapshots.back()) snapshots.push_back(get_snapshot());
+          }
+          else if (button.GetButtonState() == fsweep::ButtonState::None)
+          {
+            game_model.ClickButton(x, y);
+            snapshots.push_back(get_snapshot());
+          }
+        }
+      }
+      REQUIRE(game_model.GetGameState() == fsweep::GameState::Cool);
+
+      THEN("Every undo goes back to the game before the action and every redo returns to it")
+      {
+        for (auto snapshot_i = snapshots.size() - 1; snapshot_i > 0; snapshot_i--)
+        {
+          REQUIRE(game_model.Undo() == true);
+          REQUIRE(get_snapshot() == snapshots[snapshot_i - 1]);
+        }
+        CHECK(game_model.Undo() == false);
+        for (std::size_t snapshot_i = 1; snapshot_i < snapshots.size(); snapshot_i++)
+        {
+          REQUIRE(game_model.Redo() == true);
+          REQUIRE(get_snapshot() == snapshots[snapshot_i]);
+        }
+        CHECK(game_model.Redo() == false);
+      }
+    }
+  }
+
+  GIVEN("A GameModel with a 30x16 board, 10 bombs and a journal for 4 actions and 16 changes")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(30, 16, 10));
+    game_model.SetSeed(5);
+    game_model.SetJournalCapacity(4, 16);
+
+    WHEN("An opening of more than 16 Buttons is clicked")
+    {
+      game_model.ClickButton(15, 8);
+      REQUIRE(game_model.GetButtonsLeft() < 30 * 16 - 10 - 16);
+
+      THEN("The click can not be undone") { CHECK(game_model.GetCanUndo() == false); }
+
+      THEN("Only the last 4 of 6 alt clicks can be undone")
+      {
+        for (int alt_click_i = 0, button_i = 0; alt_click_i < 6; button_i++)
+        {
+          const int x = button_i % fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE;
+          const int y = button_i / fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE;
+          if (game_model.GetButton(x, y).GetButtonState() != fsweep::ButtonState::None) continue;
+          game_model.AltClickButton(x, y);
+          alt_click_i++;
+        }
+        for (int undo_i = 0; undo_i < 4; undo_i++)
+        {
+          CHECK(game_model.Undo() == true);
+        }
+        CHECK(game_model.Undo() == false);
+      }
+
+      THEN("A click that changes nothing drops no action from a full journal")
+      {
+        for (int alt_click_i = 0, button_i = 0; alt_click_i < 4; button_i++)
+        {
+          const int x = button_i % fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE;
+          const int y = button_i / fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE;
+          if (game_model.GetButton(x, y).GetButtonState() != fsweep::ButtonState::None) continue;
+          game_model.AltClickButton(x, y);
+          alt_click_i++;
+        }
+        game_model.ClickButton(15, 8);
+        for (int undo_i = 0; undo_i < 4; undo_i++)
+        {
+          CHECK(game_model.Undo() == true);
+        }
+        CHECK(game_model.Undo() == false);
+      }
+    }
+  }
+
+  GIVEN("A GameModel with a 1100x1000 board, 10 bombs and a journal")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(1100, 1000, 10));
+    game_model.SetSeed(9);
+    game_model.SetJournalCapacity(16, 1 << 21);
+
+    WHEN("A huge opening is clicked and undone")
+    {
+      game_model.ClickButton(550, 500);
+      const auto clicked_string = game_model.ToButtonString();
+      REQUIRE(game_model.GetButtonsLeft() < 1000);
+      CHECK(game_model.Undo() == true);
+
+      THEN("No Button is pressed")
+      {
+        CHECK(fsweep::Button::CountButtonState(game_model.GetButtons(),
+                                               fsweep::ButtonState::Down) == 0);
+        CHECK(game_model.GetGameState() == fsweep::GameState::None);
+      }
+
+      THEN("Redoing it presses the same Buttons")
+      {
+        CHECK(game_model.Redo() == true);
+        CHECK(game_model.ToButtonString() == clicked_string);
+      }
+    }
+  }
+}
+
+SCENARIO("The board hash of a GameModel is kept up to date")
+{
+  const auto get_rebuilt_hash = [](const fsweep::GameModel& game_model)
+  {
+    const auto bomb_plane = game_model.ToBombPlane();
+    const auto state_plane = game_model.ToStatePlane();
+    const fsweep::GameModel rebuilt_model(game_model.GetGameConfiguration(),
+                                          game_model.GetQuestionsEnabled(),
+                                          game_model.GetGameState(), game_model.GetGameTime(),
+                                          bomb_plane, state_plane);
+    return rebuilt_model.GetBoardHash();
+  };
+
+  GIVEN("An expert GameModel with questions and a journal")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetQuestionsEnabled(true);
+    game_model.SetSeed(11);
+    game_model.SetJournalCapacity(16, 1024);
+
+    THEN("The board hash of a new game is 0") { CHECK(game_model.GetBoardHash() == 0); }
+
+    WHEN("Buttons are clicked, flagged and questioned")
+    {
+      game_model.ClickButton(15, 8);
+      const auto clicked_hash = game_model.GetBoardHash();
+      game_model.AltClickButton(0, 0);
+      game_model.AltClickButton(29, 15);
+      game_model.AltClickButton(29, 15);
+
+      THEN("The board hash is the hash of the board computed from scratch")
+      {
+        CHECK(game_model.GetBoardHash() != 0);
+        CHECK(game_model.GetBoardHash() == get_rebuilt_hash(game_model));
+      }
+
+      THEN("Undoing the alt clicks brings back the board hash after the click")
+      {
+        game_model.Undo();
+        game_model.Undo();
+        game_model.Undo();
+        CHECK(game_model.GetBoardHash() == clicked_hash);
+      }
+
+      THEN("Removing the questions updates the board hash")
+      {
+        game_model.SetQuestionsEnabled(false);
+        CHECK(game_model.GetBoardHash() == get_rebuilt_hash(game_model));
+      }
+
+      THEN("Alt clicking the same Buttons in another order gives the same board hash")
+      {
+        auto other_model = game_model.Clone();
+        other_model.AltClickButton(29, 15);
+        other_model.AltClickButton(3, 0);
+        game_model.AltClickButton(3, 0);
+        game_model.AltClickButton(29, 15);
+        CHECK(game_model.GetBoardHash() == other_model.GetBoardHash());
+      }
+
+      THEN("A new game resets the board hash")
+      {
+        game_model.NewGame();
+        CHECK(game_model.GetBoardHash() == 0);
+      }
+    }
+  }
+
+  GIVEN("A GameModel with a 1100x1000 board and 10 bombs")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(1100, 1000, 10));
+    game_model.SetSeed(9);
+
+    WHEN("A huge opening is flood filled in parallel")
+    {
+      game_model.ClickButton(550, 500);
+
+      THEN("The board hash is the hash of the board computed from scratch")
+      {
+        CHECK(game_model.GetBoardHash() == get_rebuilt_hash(game_model));
+      }
+    }
+  }
+}
+
+SCENARIO("The frontier of a GameModel is tracked")
+{
+  // the frontier found by scanning the whole board
+  const auto check_frontier = [](const fsweep::GameModel& game_model)
+  {
+    const auto game_configuration = game_model.GetGameConfiguration();
+    const auto buttons_wide = game_configuration.GetButtonsWide();
+    const auto buttons_tall = game_configuration.GetButtonsTall();
+    const auto is_number = [&](int x, int y)
+    {
+      const auto& button = game_model.GetButton(x, y);
+      return button.GetButtonState() == fsweep::ButtonState::Down && !button.GetHasBomb() &&
+             button.GetSurroundingBombs() > 0;
+    };
+    const auto is_covered = [&](int x, int y)
+    {
+      return game_model.GetButton(x, y).GetButtonState() != fsweep::ButtonState::Down;
+    };
+    std::vector<std::size_t> covered_frontier;
+    std::vector<std::size_t> number_frontier;
+    for (int y = 0; y < buttons_tall; y++)
+    {
+      for (int x = 0; x < buttons_wide; x++)
+      {
+        bool has_number = false;
+        bool has_covered = false;
+        for (int neighbour_y = std::max(y - 1, 0);
+             neighbour_y <= std::min(y + 1, buttons_tall - 1); neighbour_y++)
+        {
+          for (int neighbour_x = std::max(x - 1, 0);
+               neighbour_x <= std::min(x + 1, buttons_wide - 1); neighbour_x++)
+          {
+            if (neighbour_x == x && neighbour_y == y) continue;
+            has_number = has_number || is_number(neighbour_x, neighbour_y);
+            has_covered = has_covered || is_covered(neighbour_x, neighbour_y);
+          }
+        }
+        const auto button_i = fsweep::ButtonPosition(x, y).GetIndex(buttons_wide);
+        if (is_covered(x, y) && has_number) covered_frontier.push_back(button_i);
+        if (is_number(x, y) && has_covered) number_frontier.push_back(button_i);
+      }
+    }
+    std::vector<std::size_t> tracked_covered_frontier(game_model.GetCoveredFrontier().begin(),
+                                                      game_model.GetCoveredFrontier().end());
+    std::vector<std::size_t> tracked_number_frontier(game_model.GetNumberFrontier().begin(),
+                                                     game_model.GetNumberFrontier().end());
+    std::sort(tracked_covered_frontier.begin(), tracked_covered_frontier.end());
+    std::sort(tracked_number_frontier.begin(), tracked_number_frontier.end());
+    CHECK(tracked_covered_frontier == covered_frontier);
+    CHECK(tracked_number_frontier == number_frontier);
+  };
+
+  GIVEN("An expert GameModel with frontier tracking and a journal")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetSeed(3);
+    game_model.SetJournalCapacity(64, 4096);
+    game_model.SetFrontierTracking(true);
+
+    THEN("The frontier of a new game is empty")
+    {
+      CHECK(game_model.GetCoveredFrontier().empty());
+      CHECK(game_model.GetNumberFrontier().empty());
+    }
+
+    WHEN("The first Button is clicked")
+    {
+      game_model.ClickButton(15, 8);
+
+      THEN("The frontier is not empty") { CHECK(!game_model.GetNumberFrontier().empty()); }
+
+      THEN("The frontier is the frontier found by scanning") { check_frontier(game_model); }
+
+      THEN("The frontier stays the frontier found by scanning through a game")
+      {
+        const auto& buttons = game_model.GetButtons();
+        for (std::size_t button_i = 0; button_i < buttons.size(); button_i += 7)
+        {
+          const auto x =
+              static_cast<int>(button_i % fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE);
+          const auto y =
+              static_cast<int>(button_i / fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE);
+          if (buttons[button_i].GetHasBomb())
+          {
+            game_model.AltClickButton(x, y);
+          }
+          else
+          {
+            game_model.ClickButton(x, y);
+          }
+        }
+        check_frontier(game_model);
+        game_model.AreaClickButton(15, 8);
+        check_frontier(game_model);
+        game_model.Undo();
+        game_model.Undo();
+        check_frontier(game_model);
+        game_model.Redo();
+        check_frontier(game_model);
+      }
+
+      THEN("Clicking a bomb keeps the frontier found by scanning")
+      {
+        const auto& buttons = game_model.GetButtons();
+        const auto bomb_i = static_cast<std::size_t>(
+            std::find_if(buttons.begin(), buttons.end(),
+                         [](const fsweep::Button& button) { return button.GetHasBomb(); }) -
+            buttons.begin());
+        game_model.ClickButton(
+            static_cast<int>(bomb_i % fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE),
+            static_cast<int>(bomb_i / fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE));
+        REQUIRE(game_model.GetGameState() == fsweep::GameState::Dead);
+        check_frontier(game_model);
+      }
+
+      THEN("Undoing the first click empties the frontier")
+      {
+        game_model.Undo();
+        CHECK(game_model.GetCoveredFrontier().empty());
+        CHECK(game_model.GetNumberFrontier().empty());
+      }
+
+      THEN("A new game with another configuration empties the frontier")
+      {
+        game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Beginner));
+        CHECK(game_model.GetCoveredFrontier().empty());
+        game_model.ClickButton(4, 4);
+        check_frontier(game_model);
+      }
+    }
+  }
+
+  GIVEN("An expert GameModel that is clicked before frontier tracking is turned on")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetSeed(3);
+    game_model.ClickButton(15, 8);
+    game_model.SetFrontierTracking(true);
+
+    THEN("The frontier is the frontier found by scanning") { check_frontier(game_model); }
+  }
+
+  GIVEN("A GameModel with a 1100x1000 board, 10 bombs and frontier tracking")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(1100, 1000, 10));
+    game_model.SetSeed(9);
+    game_model.SetFrontierTracking(true);
+
+    WHEN("A huge opening is flood filled in parallel")
+    {
+      game_model.ClickButton(550, 500);
+
+      THEN("The frontier is the frontier found by scanning") { check_frontier(game_model); }
+    }
+  }
+}
+
 SCENARIO("A Button of a GameModel is alt clicked")
 {
   GIVEN("A default constructed GameModel")
@@ -0,0 +1,338 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameDifficulty.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/GameState.hpp>
+#include <fsweep/Hint.hpp>
+#include <fsweep/HintEngine.hpp>
+#include <fsweep/RiskLayer.hpp>
+#include <fsweep/RiskSampler.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+  fsweep::GameModel createHintGameModel(int buttons_wide, int buttons_tall, int bomb_count,
+                                        const std::string& button_string)
+  {
+    return fsweep::GameModel(fsweep::GameConfiguration(buttons_wide, buttons_tall, bomb_count),
+                             false, fsweep::GameState::Playing, 0, button_string);
+  }
+}  // namespace
+
+SCENARIO("A HintEngine analyses a board", "[HintEngine]")
+{
+  GIVEN("A new game")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+
+    THEN("The center Button is a safe hint")
+    {
+      const auto hint = fsweep::HintEngine::Analyze(game_model);
+      REQUIRE(hint.has_value());
+      CHECK(hint->x == fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE / 2);
+      CHECK(hint->y == fsweep::GameConfiguration::EXPERT_BUTTONS_TALL / 2);
+      CHECK(hint->GetIsSafe());
+      CHECK(hint->board_hash == game_model.GetBoardHash());
+    }
+  }
+
+  GIVEN("A board where a number is satisfied by a bomb found from another number")
+  {
+    const auto game_model = createHintGameModel(8, 1, 3, "bdbd...b");
+
+    THEN("The Button next to the satisfied number is a safe hint")
+    {
+      const auto hint = fsweep::HintEngine::Analyze(game_model);
+      REQUIRE(hint.has_value());
+      CHECK(hint->x == 4);
+      CHECK(hint->y == 0);
+      CHECK(hint->GetIsSafe());
+    }
+  }
+
+  GIVEN("A board where only the Buttons around a number within another number decide a Button")
+  {
+    auto game_model = createHintGameModel(8, 2, 3,
+                                          "b......b"
+                                          "dd.....b");
+
+    THEN("The Buttons only next to the larger number are safe")
+    {
+      const auto hint = fsweep::HintEngine::Analyze(game_model);
+      REQUIRE(hint.has_value());
+      CHECK(hint->x == 2);
+      CHECK(hint->y == 0);
+      CHECK(hint->GetIsSafe());
+    }
+
+    WHEN("Frontier tracking is on")
+    {
+      game_model.SetFrontierTracking(true);
+
+      THEN("The hint is the same")
+      {
+        const auto hint = fsweep::HintEngine::Analyze(game_model);
+        REQUIRE(hint.has_value());
+        CHECK(hint->x == 2);
+        CHECK(hint->y == 0);
+      }
+    }
+  }
+
+  GIVEN("A board without a safe Button")
+  {
+    const auto game_model = createHintGameModel(8, 1, 3, "bd....bb");
+
+    THEN("The hint is the Button with the lowest risk")
+    {
+      const auto hint = fsweep::HintEngine::Analyze(game_model);
+      REQUIRE(hint.has_value());
+      CHECK(hint->x == 3);
+      CHECK(!hint->GetIsSafe());
+      CHECK(hint->risk == Catch::Approx(0.4));
+    }
+
+    WHEN("The risks are sampled")
+    {
+      fsweep::ThreadPool thread_pool(2);
+      fsweep::RiskSampler risk_sampler(thread_pool);
+      risk_sampler.SetTimeBudget(std::chrono::milliseconds(50));
+
+      THEN("The hint and the risks agree with the exact risks")
+      {
+        const auto hint = fsweep::HintEngine::Analyze(game_model, &risk_sampler);
+        REQUIRE(hint.has_value());
+        CHECK(hint->x == 3);
+        CHECK(hint->risk == Catch::Approx(0.4).margin(0.05));
+        const auto risks = fsweep::HintEngine::AnalyzeRisks(game_model, &risk_sampler);
+        CHECK(risks[0] == Catch::Approx(0.5).margin(0.05));
+        CHECK(risks[2] == Catch::Approx(0.5).margin(0.05));
+        CHECK(risks[3] == Catch::Approx(0.4).margin(0.05));
+      }
+    }
+  }
+
+  GIVEN("A board with known and estimated risks")
+  {
+    const auto game_model = createHintGameModel(8, 1, 3, "bdbd...b");
+
+    THEN("Every covered Button has a risk")
+    {
+      const auto risks = fsweep::HintEngine::AnalyzeRisks(game_model);
+      REQUIRE(risks.size() == 8);
+      CHECK(risks[0] == 1.0f);
+      CHECK(risks[1] == fsweep::RiskLayer::NO_RISK);
+      CHECK(risks[2] == 1.0f);
+      CHECK(risks[3] == fsweep::RiskLayer::NO_RISK);
+      CHECK(risks[4] == 0.0f);
+      CHECK(risks[5] == Catch::Approx(1.0f / 3.0f));
+      CHECK(risks[7] == Catch::Approx(1.0f / 3.0f));
+    }
+  }
+
+  GIVEN("A lost game")
+  {
+    const auto game_model = fsweep::GameModel(fsweep::GameConfiguration(8, 1, 1), false,
+                                              fsweep::GameState::Dead, 0, "xd......");
+
+    THEN("There is no hint") { CHECK(!fsweep::HintEngine::Analyze(game_model).has_value()); }
+
+    THEN("There are no risks")
+    {
+      for (const auto risk : fsweep::HintEngine::AnalyzeRisks(game_model))
+      {
+        CHECK(risk == fsweep::RiskLayer::NO_RISK);
+      }
+    }
+  }
+}
+
+SCENARIO("A HintEngine finds hints in the background", "[HintEngine]")
+{
+  GIVEN("A HintEngine and an expert game with frontier tracking")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetSeed(3);
+    game_model.SetFrontierTracking(true);
+    game_model.ClickButton(15, 8);
+    fsweep::HintEngine hint_engine;
+    std::mutex mutex;
+    std::condition_variable hint_condition;
+    int hint_count = 0;
+    hint_engine.SetHintListener(
+        [&]()
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          hint_count++;
+          hint_condition.notify_all();
+        });
+    const auto wait_for_hints = [&](int count)
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      return hint_condition.wait_for(lock, std::chrono::seconds(10),
+                                     [&]() { return hint_count >= count; });
+    };
+
+    WHEN("A hint is requested")
+    {
+      REQUIRE(hint_engine.Request(game_model));
+      REQUIRE(wait_for_hints(1));
+
+      THEN("A safe hint matches the hint found directly and a guess is never called safe")
+      {
+        const auto hint = hint_engine.GetHint(game_model);
+        const auto analyzed_hint = fsweep::HintEngine::Analyze(game_model);
+        REQUIRE(hint.has_value());
+        REQUIRE(analyzed_hint.has_value());
+        CHECK(hint->GetIsSafe() == analyzed_hint->GetIsSafe());
+        if (analyzed_hint->GetIsSafe())
+        {
+          CHECK(hint->x == analyzed_hint->x);
+          CHECK(hint->y == analyzed_hint->y);
+        }
+      }
+
+      THEN("The latency of the hint is recorded")
+      {
+        const auto latency_histogram = hint_engine.GetLatencyHistogram();
+        CHECK(latency_histogram.GetCount() == 1);
+        CHECK(latency_histogram.GetMax() == hint_engine.GetHint(game_model)->latency_us);
+      }
+
+      THEN("The same board is not requested again") { CHECK(!hint_engine.Request(game_model)); }
+
+      THEN("There are no risk changes without risk tracking")
+      {
+        std::vector<std::pair<std::size_t, std::uint8_t>> risk_changes;
+        CHECK(!hint_engine.TakeRiskChanges(game_model, risk_changes));
+      }
+
+      AND_WHEN("Risk tracking is turned on")
+      {
+        hint_engine.SetRiskTracking(true);
+        REQUIRE(hint_engine.Request(game_model));
+        REQUIRE(wait_for_hints(2));
+
+        THEN("Every covered Button has a changed level")
+        {
+          std::vector<std::pair<std::size_t, std::uint8_t>> risk_changes;
+          REQUIRE(hint_engine.TakeRiskChanges(game_model, risk_changes));
+          CHECK(static_cast<std::int64_t>(risk_changes.size()) ==
+                game_model.GetButtonsLeft() + game_model.GetGameConfiguration().GetBombCount());
+          CHECK(!hint_engine.TakeRiskChanges(game_model, risk_changes));
+        }
+
+        THEN("The changes of a board are only given out while it is the current board")
+        {
+          std::vector<std::pair<std::size_t, std::uint8_t>> risk_changes;
+          auto changed_game_model = game_model.Clone();
+          changed_game_model.AltClickButton(0, 0);
+          CHECK(!hint_engine.TakeRiskChanges(changed_game_model, risk_changes));
+          CHECK(hint_engine.TakeRiskChanges(game_model, risk_changes));
+        }
+      }
+
+      AND_WHEN("The board changes")
+      {
+        const auto hint = hint_engine.GetHint(game_model);
+        REQUIRE(hint.has_value());
+        game_model.AltClickButton(hint->x, hint->y);
+
+        THEN("The stale hint is discarded") { CHECK(!hint_engine.GetHint(game_model)); }
+
+        THEN("A new hint is found for the new board")
+        {
+          REQUIRE(hint_engine.Request(game_model));
+          REQUIRE(wait_for_hints(2));
+          const auto new_hint = hint_engine.GetHint(game_model);
+          REQUIRE(new_hint.has_value());
+          CHECK(new_hint->board_hash == game_model.GetBoardHash());
+        }
+      }
+    }
+
+    WHEN("A hint is requested for a new expert game and a new beginner game is started")
+    {
+      game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+      REQUIRE(hint_engine.Request(game_model));
+      REQUIRE(wait_for_hints(1));
+      REQUIRE(hint_engine.GetHint(game_model).has_value());
+      game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Beginner));
+
+      THEN("The hint of the expert board is discarded although both boards have the same hash")
+      {
+        CHECK(!hint_engine.GetHint(game_model));
+      }
+
+      THEN("The beginner board is analysed for a hint in its own center")
+      {
+        REQUIRE(hint_engine.Request(game_model));
+        REQUIRE(wait_for_hints(2));
+        const auto hint = hint_engine.GetHint(game_model);
+        REQUIRE(hint.has_value());
+        CHECK(hint->x == fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE / 2);
+        CHECK(hint->y == fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL / 2);
+      }
+    }
+
+    WHEN("Risks are tracked for a new expert game and a new beginner game is started")
+    {
+      hint_engine.SetRiskTracking(true);
+      game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+      REQUIRE(hint_engine.Request(game_model));
+      REQUIRE(wait_for_hints(1));
+      game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Beginner));
+
+      THEN("The changes of the expert board are not given out for the beginner board")
+      {
+        std::vector<std::pair<std::size_t, std::uint8_t>> risk_changes;
+        CHECK(!hint_engine.TakeRiskChanges(game_model, risk_changes));
+      }
+
+      THEN("The beginner board is analysed for changes of its own Buttons")
+      {
+        REQUIRE(hint_engine.Request(game_model));
+        REQUIRE(wait_for_hints(2));
+        std::vector<std::pair<std::size_t, std::uint8_t>> risk_changes;
+        REQUIRE(hint_engine.TakeRiskChanges(game_model, risk_changes));
+        CHECK(risk_changes.size() == game_model.GetGameConfiguration().GetButtonCount());
+        for (const auto& [button_i, level] : risk_changes)
+        {
+          CHECK(button_i < game_model.GetGameConfiguration().GetButtonCount());
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <fsweep/LatencyHistogram.hpp>
+
+SCENARIO("Values are mapped to LatencyHistogram buckets")
+{
+  GIVEN("Values below two sub bucket spans")
+  {
+    THEN("Each value has its own bucket")
+    {
+      CHECK(fsweep::LatencyHistogram::GetBucketIndex(0) == 0);
+      CHECK(fsweep::LatencyHistogram::GetBucketIndex(255) == 255);
+      CHECK(fsweep::LatencyHistogram::GetBucketLowestValue(255) == 255);
+      CHECK(fsweep::LatencyHistogram::GetBucketHighestValue(255) == 255);
+    }
+  }
+
+  GIVEN("Values above two sub bucket spans")
+  {
+    THEN("Buckets are contiguous and keep the relative error below one percent")
+    {
+      CHECK(fsweep::LatencyHistogram::GetBucketIndex(256) == 256);
+      CHECK(fsweep::LatencyHistogram::GetBucketIndex(257) == 256);
+      CHECK(fsweep::LatencyHistogram::GetBucketIndex(511) == 383);
+      CHECK(fsweep::LatencyHistogram::GetBucketIndex(512) == 384);
+      const std::uint64_t values[] = {1000, 123456, 987654321, UINT64_MAX};
+      for (const auto value : values)
+      {
+        const auto bucket_i = fsweep::LatencyHistogram::GetBucketIndex(value);
+        const auto lowest = fsweep::LatencyHistogram::GetBucketLowestValue(bucket_i);
+        const auto highest = fsweep::LatencyHistogram::GetBucketHighestValue(bucket_i);
+        CHECK(bucket_i < fsweep::LatencyHistogram::BUCKET_COUNT);
+        CHECK(lowest <= value);
+        CHECK(highest >= value);
+        CHECK(static_cast<double>(highest - lowest) / static_cast<double>(lowest) < 0.01);
+      }
+    }
+  }
+}
+
+SCENARIO("Percentiles are read from a LatencyHistogram")
+{
+  GIVEN("An empty LatencyHistogram")
+  {
+    const fsweep::LatencyHistogram latency_histogram;
+
+    THEN("Every statistic is 0")
+    {
+      CHECK(latency_histogram.GetCount() == 0);
+      CHECK(latency_histogram.GetMin() == 0);
+      CHECK(latency_histogram.GetMax() == 0);
+      CHECK(latency_histogram.GetMean() == 0.0);
+      CHECK(latency_histogram.GetValueAtPercentile(50.0) == 0);
+    }
+  }
+
+  GIVEN("A LatencyHistogram with the values 1 to 1000 recorded")
+  {
+    fsweep::LatencyHistogram latency_histogram;
+    for (std::uint64_t value = 1; value <= 1000; value++)
+    {
+      latency_histogram.Record(value);
+    }
+
+    THEN("The statistics are correct")
+    {
+      CHECK(latency_histogram.GetCount() == 1000);
+      CHECK(latency_histogram.GetMin() == 1);
+      CHECK(latency_histogram.GetMax() == 1000);
+      CHECK_THAT(latency_histogram.GetMean(), Catch::Matchers::WithinRel(500.5, 0.001));
+    }
+
+    THEN("The percentiles are within the bucket precision")
+    {
+      CHECK_THAT(static_cast<double>(latency_histogram.GetValueAtPercentile(50.0)),
+                 Catch::Matchers::WithinRel(500.0, 0.01));
+      CHECK_THAT(static_cast<double>(latency_histogram.GetValueAtPercentile(99.0)),
+                 Catch::Matchers::WithinRel(990.0, 0.01));
+      CHECK_THAT(static_cast<double>(latency_histogram.GetValueAtPercentile(99.9)),
+                 Catch::Matchers::WithinRel(999.0, 0.01));
+      CHECK(latency_histogram.GetValueAtPercentile(100.0) == 1000);
+    }
+
+    WHEN("It is merged with a LatencyHistogram holding one large value")
+    {
+      fsweep::LatencyHistogram other_histogram;
+      other_histogram.Record(1000000);
+      latency_histogram.Merge(other_histogram);
+
+      THEN("The count and the maximum include the merged value")
+      {
+        CHECK(latency_histogram.GetCount() == 1001);
+        CHECK(latency_histogram.GetMax() == 1000000);
+        CHECK(latency_histogram.GetValueAtPercentile(100.0) == 1000000);
+      }
+    }
+
+    WHEN("It is reset")
+    {
+      latency_histogram.Reset();
+
+      THEN("It is empty") { CHECK(latency_histogram.GetCount() == 0); }
+    }
+  }
+}
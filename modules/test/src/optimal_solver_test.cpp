@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <bit>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/ButtonPosition.hpp>
+#include <fsweep/GameConfiguration.hpp>
+#include <fsweep/GameDifficulty.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/GameState.hpp>
+#include <fsweep/OptimalSolver.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+  // plays the moves of the solver against every arrangement of bombs that the first click allows
+  // and returns the share of games won
+  double playOptimalMoves(fsweep::OptimalSolver& optimal_solver,
+                          const fsweep::GameConfiguration& game_configuration,
+                          fsweep::ButtonPosition first_click)
+  {
+    const auto button_count = game_configuration.GetButtonCount();
+    const auto buttons_wide = game_configuration.GetButtonsWide();
+    const auto first_i = first_click.GetIndex(buttons_wide);
+    std::uint64_t arrangement_count = 0;
+    std::uint64_t win_count = 0;
+    for (std::uint64_t bomb_mask = 0; bomb_mask < (std::uint64_t(1) << button_count); bomb_mask++)
+    {
+      if (std::popcount(bomb_mask) != game_configuration.GetBombCount() ||
+          ((bomb_mask >> first_i) & 1) != 0)
+      {
+        continue;
+      }
+      std::string button_string(button_count, '.');
+      for (std::size_t button_i = 0; button_i < button_count; button_i++)
+      {
+        if ((bomb_mask >> button_i) & 1) button_string[button_i] = 'b';
+      }
+      fsweep::GameModel game_model(game_configuration, false, fsweep::GameState::Playing, 0,
+                                   button_string);
+      game_model.ClickButton(first_click.x, first_click.y);
+      while (game_model.GetGameState() == fsweep::GameState::Playing)
+      {
+        const auto move = optimal_solver.GetMove(game_model);
+        if (!move) break;
+        game_model.ClickButton(move->x, move->y);
+      }
+      arrangement_count++;
+      if (game_model.GetGameState() == fsweep::GameState::Cool) win_count++;
+    }
+    return static_cast<double>(win_count) / static_cast<double>(arrangement_count);
+  }
+}  // namespace
+
+SCENARIO("An OptimalSolver finds the best chance of winning a tiny board", "[OptimalSolver]")
+{
+  fsweep::ThreadPool thread_pool(2);
+
+  GIVEN("A single row with one bomb")
+  {
+    const fsweep::GameConfiguration game_configuration(8, 1, 1);
+    fsweep::OptimalSolver optimal_solver(game_configuration);
+    optimal_solver.Solve(thread_pool);
+
+    THEN("Every first click always wins")
+    {
+      for (int x = 0; x < 8; x++)
+      {
+        CHECK(optimal_solver.GetFirstClickWinProbability(x, 0) == 1.0);
+      }
+      CHECK(optimal_solver.GetWinProbability() == 1.0);
+    }
+  }
+
+  GIVEN("Two rows with three bombs")
+  {
+    const fsweep::GameConfiguration game_configuration(8, 2, 3);
+    fsweep::OptimalSolver optimal_solver(game_configuration);
+    optimal_solver.Solve(thread_pool);
+
+    THEN("Playing its moves wins as often as it says from every first click")
+    {
+      for (int x = 0; x < 8; x++)
+      {
+        const fsweep::ButtonPosition first_click(x, 1);
+        CHECK(playOptimalMoves(optimal_solver, game_configuration, first_click) ==
+              Catch::Approx(optimal_solver.GetFirstClickWinProbability(x, 1)));
+      }
+    }
+
+    THEN("The best first click is the most likely to win")
+    {
+      const auto first_click = optimal_solver.GetFirstClick();
+      for (int y = 0; y < 2; y++)
+      {
+        for (int x = 0; x < 8; x++)
+        {
+          CHECK(optimal_solver.GetFirstClickWinProbability(x, y) <=
+                optimal_solver.GetWinProbability());
+        }
+      }
+      CHECK(optimal_solver.GetFirstClickWinProbability(first_click.x, first_click.y) ==
+            optimal_solver.GetWinProbability());
+      CHECK(optimal_solver.GetWinProbability() > 0.0);
+      CHECK(optimal_solver.GetWinProbability() < 1.0);
+    }
+
+    THEN("Solving on one thread gives the same chance")
+    {
+      fsweep::ThreadPool single_thread_pool(1);
+      fsweep::OptimalSolver single_optimal_solver(game_configuration);
+      single_optimal_solver.Solve(single_thread_pool);
+      CHECK(single_optimal_solver.GetWinProbability() == optimal_solver.GetWinProbability());
+      CHECK(single_optimal_solver.GetStateCount() > 0);
+    }
+
+    WHEN("A game is played with moves the solver would not make")
+    {
+      fsweep::GameModel game_model(game_configuration, false, fsweep::GameState::Playing, 0,
+                                   "b......."
+                                   "...b...b");
+      game_model.ClickButton(4, 0);
+
+      THEN("It still gives a move and a chance for the board")
+      {
+        CHECK(optimal_solver.GetMove(game_model).has_value());
+        const auto win_probability = optimal_solver.GetStateWinProbability(game_model);
+        CHECK(win_probability > 0.0);
+        CHECK(win_probability <= 1.0);
+      }
+    }
+  }
+
+  GIVEN("A board with too many arrangements")
+  {
+    const fsweep::GameConfiguration game_configuration(fsweep::GameDifficulty::Expert);
+
+    THEN("It cannot be solved")
+    {
+      CHECK_THROWS_AS(fsweep::OptimalSolver(game_configuration), std::runtime_error);
+    }
+  }
+}
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <fsweep/Button.hpp>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/PresetBoard.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+  bool hasPatternBomb(int x, int y) { return ((x * 7) + (y * 13)) % 5 == 0; }
+
+  int countPatternBombs(int x, int y, int buttons_wide, int buttons_tall)
+  {
+    int surrounding_bombs = 0;
+    for (int neighbour_y = y - 1; neighbour_y <= y + 1; neighbour_y++)
+    {
+      for (int neighbour_x = x - 1; neighbour_x <= x + 1; neighbour_x++)
+      {
+        if (neighbour_x == x && neighbour_y == y) continue;
+        if (neighbour_x < 0 || neighbour_y < 0) continue;
+        if (neighbour_x >= buttons_wide || neighbour_y >= buttons_tall) continue;
+        if (hasPatternBomb(neighbour_x, neighbour_y)) surrounding_bombs++;
+      }
+    }
+    return surrounding_bombs;
+  }
+
+  template <typename Board>
+  std::vector<fsweep::Button> makePatternButtons(int buttons_wide, int buttons_tall)
+  {
+    std::vector<fsweep::Button> buttons(Board::BUTTON_COUNT);
+    for (int y = 0; y < buttons_tall; y++)
+    {
+      for (int x = 0; x < buttons_wide; x++)
+      {
+        buttons[(y * buttons_wide) + x].SetHasBomb(hasPatternBomb(x, y));
+      }
+    }
+    Board::CalculateSurroundingBombs(buttons.data());
+    return buttons;
+  }
+
+  void checkPatternCounts(const std::vector<fsweep::Button>& buttons, int buttons_wide,
+                          int buttons_tall)
+  {
+    for (int y = 0; y < buttons_tall; y++)
+    {
+      for (int x = 0; x < buttons_wide; x++)
+      {
+        CHECK(buttons[(y * buttons_wide) + x].GetSurroundingBombs() ==
+              countPatternBombs(x, y, buttons_wide, buttons_tall));
+      }
+    }
+  }
+}  // namespace
+
+SCENARIO("The surrounding bombs of a PresetBoard are calculated")
+{
+  GIVEN("Beginner Buttons with a bomb pattern")
+  {
+    const auto buttons =
+        makePatternButtons<fsweep::BeginnerBoard>(fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE,
+                                                  fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL);
+
+    THEN("Every Button has the same count as a bounds checked count")
+    {
+      checkPatternCounts(buttons, fsweep::GameConfiguration::BEGINNER_BUTTONS_WIDE,
+                         fsweep::GameConfiguration::BEGINNER_BUTTONS_TALL);
+    }
+  }
+
+  GIVEN("Intermediate Buttons with a bomb pattern")
+  {
+    const auto buttons = makePatternButtons<fsweep::IntermediateBoard>(
+        fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_WIDE,
+        fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_TALL);
+
+    THEN("Every Button has the same count as a bounds checked count")
+    {
+      checkPatternCounts(buttons, fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_WIDE,
+                         fsweep::GameConfiguration::INTERMEDIATE_BUTTONS_TALL);
+    }
+  }
+
+  GIVEN("Expert Buttons with a bomb pattern")
+  {
+    const auto buttons =
+        makePatternButtons<fsweep::ExpertBoard>(fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE,
+                                                fsweep::GameConfiguration::EXPERT_BUTTONS_TALL);
+
+    THEN("Every Button has the same count as a bounds checked count")
+    {
+      checkPatternCounts(buttons, fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE,
+                         fsweep::GameConfiguration::EXPERT_BUTTONS_TALL);
+    }
+  }
+}
+
+SCENARIO("A GameModel with a preset difficulty is constructed from a button string")
+{
+  GIVEN("An expert button string with a bomb pattern")
+  {
+    const auto buttons_wide = fsweep::GameConfiguration::EXPERT_BUTTONS_WIDE;
+    const auto buttons_tall = fsweep::GameConfiguration::EXPERT_BUTTONS_TALL;
+    std::string button_string;
+    for (int y = 0; y < buttons_tall; y++)
+    {
+      for (int x = 0; x < buttons_wide; x++)
+      {
+        button_string += hasPatternBomb(x, y) ? 'b' : '.';
+      }
+    }
+    const fsweep::GameModel game_model(
+        fsweep::GameConfiguration(fsweep::GameDifficulty::Expert), false,
+        fsweep::GameState::Playing, 0, button_string);
+
+    THEN("The GameModel has the same counts as a bounds checked count")
+    {
+      checkPatternCounts(game_model.GetButtons(), buttons_wide, buttons_tall);
+    }
+  }
+}
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/ReplayEvent.hpp>
+#include <fsweep/ReplayPlayer.hpp>
+#include <fsweep/ReplayReader.hpp>
+#include <fsweep/ReplayWriter.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // plays an expert game with questions until it is won and records every action
+  std::string recordExpertGame()
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetQuestionsEnabled(true);
+    game_model.SetSeed(77);
+    std::ostringstream stream;
+    fsweep::ReplayWriter replay_writer(stream, game_model.GetGameConfiguration(),
+                                       game_model.GetQuestionsEnabled(), game_model.GetSeed());
+    game_model.SetActionListener(
+        [&](fsweep::GameAction game_action, int x, int y)
+        {
+          replay_writer.Write(fsweep::ReplayEvent(game_model.GetGameTime(), game_action, x, y));
+        });
+    unsigned int game_time = 0;
+    game_model.AltClickButton(0, 0);
+    game_model.AltClickButton(0, 0);
+    game_model.AltClickButton(0, 0);
+    game_model.ClickButton(15, 8);
+    const auto game_configuration = game_model.GetGameConfiguration();
+    for (int y = 0; y < game_configuration.GetButtonsTall(); y++)
+    {
+      for (int x = 0; x < game_configuration.GetButtonsWide(); x++)
+      {
+        const auto& button = game_model.GetButton(x, y);
+        if (button.GetButtonState() == fsweep::ButtonState::Down) continue;
+        game_time += 700;
+        game_model.UpdateTime(game_time);
+        if (button.GetHasBomb())
+        {
+          game_model.AltClickButton(x, y);
+          game_model.AreaClickButton(x, y);
+        }
+        else
+        {
+          game_model.ClickButton(x, y);
+        }
+      }
+    }
+    REQUIRE(game_model.GetGameState() == fsweep::GameState::Cool);
+    replay_writer.Flush();
+    return stream.str();
+  }
+
+  void checkSameGame(const fsweep::GameModel& a, const fsweep::GameModel& b)
+  {
+    CHECK(a.GetGameState() == b.GetGameState());
+    CHECK(a.GetGameTime() == b.GetGameTime());
+    CHECK(a.GetFlagCount() == b.GetFlagCount());
+    CHECK(a.GetButtonsLeft() == b.GetButtonsLeft());
+    CHECK(a.ToButtonString() == b.ToButtonString());
+  }
+}  // namespace
+
+SCENARIO("A replay is played back to any event")
+{
+  GIVEN("A ReplayPlayer for a won expert game with a checkpoint every 16 events")
+  {
+    const auto data = recordExpertGame();
+    std::istringstream stream(data);
+    fsweep::ReplayReader replay_reader(stream);
+    fsweep::ReplayPlayer replay_player(replay_reader, 16);
+
+    THEN("The ReplayPlayer is at the end of the replay")
+    {
+      CHECK(replay_player.GetEventIndex() == replay_player.GetEventCount());
+      CHECK(replay_player.GetGameModel().GetGameState() == fsweep::GameState::Cool);
+    }
+
+    THEN("There is a checkpoint for every 16 events")
+    {
+      CHECK(replay_player.GetCheckpointCount() == (replay_player.GetEventCount() + 15) / 16);
+    }
+
+    WHEN("The ReplayPlayer seeks to every event backwards and forwards")
+    {
+      const auto event_count = replay_player.GetEventCount();
+      std::vector<std::size_t> event_indices;
+      for (std::size_t event_i = 0; event_i <= event_count; event_i += 7)
+      {
+        event_indices.push_back(event_count - event_i);
+        event_indices.push_back(event_i);
+        event_indices.push_back(event_i + 1 <= event_count ? event_i + 1 : event_i);
+      }
+
+      THEN("The game is the same as the game played from the start to the event")
+      {
+        for (const auto event_i : event_indices)
+        {
+          replay_player.Seek(event_i);
+          REQUIRE(replay_player.GetEventIndex() == event_i);
+          std::istringstream expected_stream(data);
+          fsweep::ReplayReader expected_reader(expected_stream);
+          auto expected_model = expected_reader.CreateGameModel();
+          fsweep::ReplayEvent replay_event;
+          for (std::size_t played_i = 0; played_i < event_i; played_i++)
+          {
+            REQUIRE(expected_reader.Read(replay_event));
+            fsweep::ReplayReader::Play(replay_event, *expected_model);
+          }
+          checkSameGame(replay_player.GetGameModel(), *expected_model);
+        }
+      }
+    }
+
+    THEN("Seeking past the end of the replay throws")
+    {
+      CHECK_THROWS_AS(replay_player.Seek(replay_player.GetEventCount() + 1), std::runtime_error);
+    }
+  }
+
+  GIVEN("A replay without events")
+  {
+    fsweep::GameModel game_model;
+    std::ostringstream write_stream;
+    {
+      fsweep::ReplayWriter replay_writer(write_stream, game_model.GetGameConfiguration(), false, 3);
+    }
+    std::istringstream stream(write_stream.str());
+    fsweep::ReplayReader replay_reader(stream);
+    fsweep::ReplayPlayer replay_player(replay_reader);
+
+    WHEN("The ReplayPlayer seeks to the start")
+    {
+      replay_player.Seek(0);
+
+      THEN("The game has not started")
+      {
+        CHECK(replay_player.GetEventCount() == 0);
+        CHECK(replay_player.GetGameModel().GetGameState() == fsweep::GameState::None);
+      }
+    }
+  }
+}
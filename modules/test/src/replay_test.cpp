@@ -0,0 +1,233 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <fsweep/GameModel.hpp>
+#include <fsweep/ReplayEvent.hpp>
+#include <fsweep/ReplayReader.hpp>
+#include <fsweep/ReplayWriter.hpp>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  // records every action of the GameModel while it is played
+  std::string recordGame(fsweep::GameModel& game_model,
+                         std::vector<fsweep::ReplayEvent>& replay_events,
+                         const std::function<void()>& play)
+  {
+    std::ostringstream stream;
+    {
+      fsweep::ReplayWriter replay_writer(stream, game_model.GetGameConfiguration(),
+                                         game_model.GetQuestionsEnabled(), game_model.GetSeed());
+      game_model.SetActionListener(
+          [&](fsweep::GameAction game_action, int x, int y)
+          {
+            const fsweep::ReplayEvent replay_event(game_model.GetGameTime(), game_action, x, y);
+            replay_events.push_back(replay_event);
+            replay_writer.Write(replay_event);
+          });
+      play();
+      game_model.SetActionListener(nullptr);
+      replay_writer.Flush();
+      CHECK(replay_writer.GetEventCount() == replay_events.size());
+    }
+    return stream.str();
+  }
+
+  std::vector<fsweep::ReplayEvent> readEvents(fsweep::ReplayReader& replay_reader)
+  {
+    std::vector<fsweep::ReplayEvent> replay_events;
+    fsweep::ReplayEvent replay_event;
+    while (replay_reader.Read(replay_event))
+    {
+      replay_events.push_back(replay_event);
+    }
+    return replay_events;
+  }
+}  // namespace
+
+SCENARIO("A game is recorded and played back as a replay")
+{
+  GIVEN("A seeded expert GameModel that is played until it is won")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetSeed(77);
+    std::vector<fsweep::ReplayEvent> replay_events;
+    const auto data = recordGame(
+        game_model, replay_events,
+        [&]()
+        {
+          // a move every 300 milliseconds
+          unsigned int game_time = 0;
+          game_model.ClickButton(15, 8);
+          const auto game_configuration = game_model.GetGameConfiguration();
+          for (int y = 0; y < game_configuration.GetButtonsTall(); y++)
+          {
+            for (int x = 0; x < game_configuration.GetButtonsWide(); x++)
+            {
+              const auto& button = game_model.GetButton(x, y);
+              if (button.GetButtonState() == fsweep::ButtonState::Down) continue;
+              game_time += 300;
+              game_model.UpdateTime(game_time);
+              if (button.GetHasBomb())
+              {
+                game_model.AltClickButton(x, y);
+              }
+              else
+              {
+                game_model.ClickButton(x, y);
+              }
+            }
+          }
+        });
+    REQUIRE(game_model.GetGameState() == fsweep::GameState::Cool);
+
+    THEN("The replay takes about 2 bytes per event")
+    {
+      CHECK(data.size() - fsweep::ReplayWriter::HEADER_SIZE < replay_events.size() * 5 / 2);
+    }
+
+    WHEN("The replay is read")
+    {
+      std::istringstream stream(data);
+      fsweep::ReplayReader replay_reader(stream);
+
+      THEN("The header matches the GameModel")
+      {
+        CHECK(replay_reader.GetGameConfiguration() == game_model.GetGameConfiguration());
+        CHECK(replay_reader.GetQuestionsEnabled() == game_model.GetQuestionsEnabled());
+        CHECK(replay_reader.GetSeed() == 77);
+      }
+
+      THEN("The events are the recorded events")
+      {
+        CHECK(readEvents(replay_reader) == replay_events);
+      }
+
+      THEN("Playing the events back gives the same game")
+      {
+        auto replay_model = replay_reader.CreateGameModel();
+        for (const auto& replay_event : readEvents(replay_reader))
+        {
+          fsweep::ReplayReader::Play(replay_event, *replay_model);
+        }
+        CHECK(replay_model->GetGameState() == fsweep::GameState::Cool);
+        CHECK(replay_model->GetGameTime() == game_model.GetGameTime());
+        CHECK(replay_model->GetFlagCount() == game_model.GetFlagCount());
+        CHECK(replay_model->ToButtonString() == game_model.ToButtonString());
+      }
+    }
+
+    WHEN("The replay has the wrong magic")
+    {
+      auto wrong_data = data;
+      wrong_data[0] = 'X';
+      std::istringstream stream(wrong_data);
+
+      THEN("The replay can not be read")
+      {
+        CHECK_THROWS_AS(fsweep::ReplayReader(stream), std::runtime_error);
+      }
+    }
+
+    WHEN("The last event of the replay is truncated")
+    {
+      auto truncated_data = data;
+      truncated_data.pop_back();
+      std::istringstream stream(truncated_data);
+      fsweep::ReplayReader replay_reader(stream);
+
+      THEN("Reading the last event throws")
+      {
+        CHECK_THROWS_AS(readEvents(replay_reader), std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN("A seeded expert GameModel with a journal that is undone while it is recorded")
+  {
+    fsweep::GameModel game_model;
+    game_model.NewGame(fsweep::GameConfiguration(fsweep::GameDifficulty::Expert));
+    game_model.SetSeed(77);
+    game_model.SetJournalCapacity(16, 1024);
+    std::vector<fsweep::ReplayEvent> replay_events;
+    const auto data = recordGame(game_model, replay_events,
+                                 [&]()
+                                 {
+                                   game_model.ClickButton(15, 8);
+                                   game_model.AltClickButton(0, 0);
+                                   CHECK(game_model.Undo() == false);
+                                   game_model.AltClickButton(29, 15);
+                                 });
+
+    THEN("Playing the replay back gives the same game")
+    {
+      std::istringstream stream(data);
+      fsweep::ReplayReader replay_reader(stream);
+      auto replay_model = replay_reader.CreateGameModel();
+      for (const auto& replay_event : readEvents(replay_reader))
+      {
+        fsweep::ReplayReader::Play(replay_event, *replay_model);
+      }
+      CHECK(replay_model->GetFlagCount() == game_model.GetFlagCount());
+      CHECK(replay_model->ToButtonString() == game_model.ToButtonString());
+    }
+  }
+
+  GIVEN("A huge GameModel that is played for longer than one block")
+  {
+    fsweep::GameModel game_model;
+    // dense enough that the opening stays small and the alt clicks land on covered Buttons
+    game_model.NewGame(fsweep::GameConfiguration(1000, 1000, 200000));
+    game_model.SetSeed(5);
+    std::vector<fsweep::ReplayEvent> replay_events;
+    const auto data = recordGame(game_model, replay_events,
+                                 [&]()
+                                 {
+                                   game_model.ClickButton(500, 500);
+                                   for (int event_i = 0; event_i < 10000; event_i++)
+                                   {
+                                     game_model.UpdateTime(event_i * 1200);
+                                     game_model.AltClickButton((event_i * 7919) % 1000,
+                                                               (event_i * 104729) % 1000);
+                                   }
+                                 });
+
+    THEN("The replay spans more than one block")
+    {
+      CHECK(data.size() > fsweep::ReplayWriter::BLOCK_SIZE * 2);
+    }
+
+    THEN("The events read back are the recorded events")
+    {
+      std::istringstream stream(data);
+      fsweep::ReplayReader replay_reader(stream);
+      CHECK(readEvents(replay_reader) == replay_events);
+    }
+  }
+}
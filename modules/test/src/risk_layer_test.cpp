@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fsweep/RiskLayer.hpp>
+#include <vector>
+
+SCENARIO("A RiskLayer only changes levels that moved far enough", "[RiskLayer]")
+{
+  GIVEN("A RiskLayer")
+  {
+    fsweep::RiskLayer risk_layer;
+    std::vector<std::size_t> changed_is;
+
+    THEN("Risks are quantized to levels")
+    {
+      CHECK(fsweep::RiskLayer::GetRiskLevel(0.0f) == 0);
+      CHECK(fsweep::RiskLayer::GetRiskLevel(1.0f) == fsweep::RiskLayer::LEVEL_COUNT - 1);
+      CHECK(fsweep::RiskLayer::GetRiskLevel(fsweep::RiskLayer::NO_RISK) ==
+            fsweep::RiskLayer::NO_LEVEL);
+    }
+
+    WHEN("The first risks are given")
+    {
+      const std::vector<float> risks = {0.5f, fsweep::RiskLayer::NO_RISK, 0.0f, 1.0f};
+      CHECK(risk_layer.Update(risks, changed_is));
+
+      THEN("Every Button with a risk is changed")
+      {
+        CHECK(changed_is == std::vector<std::size_t>{0, 2, 3});
+        CHECK(risk_layer.GetButtonCount() == risks.size());
+        CHECK(risk_layer.GetLevel(1) == fsweep::RiskLayer::NO_LEVEL);
+        CHECK(risk_layer.GetLevel(2) == 0);
+      }
+
+      AND_WHEN("The risks change by less than the threshold")
+      {
+        changed_is.clear();
+        const std::vector<float> close_risks = {0.53f, fsweep::RiskLayer::NO_RISK, 0.0f, 1.0f};
+        CHECK(!risk_layer.Update(close_risks, changed_is));
+
+        THEN("Nothing is changed")
+        {
+          CHECK(changed_is.empty());
+          CHECK(risk_layer.GetLevel(0) == fsweep::RiskLayer::GetRiskLevel(0.5f));
+        }
+      }
+
+      AND_WHEN("The risks change by more than the threshold or become certain")
+      {
+        changed_is.clear();
+        const std::vector<float> far_risks = {0.75f, fsweep::RiskLayer::NO_RISK,
+                                              fsweep::RiskLayer::NO_RISK, 1.0f};
+        risk_layer.Update(far_risks, changed_is);
+
+        THEN("Only those Buttons are changed")
+        {
+          CHECK(changed_is == std::vector<std::size_t>{0, 2});
+          CHECK(risk_layer.GetLevel(0) == fsweep::RiskLayer::GetRiskLevel(0.75f));
+          CHECK(risk_layer.GetLevel(2) == fsweep::RiskLayer::NO_LEVEL);
+        }
+      }
+
+      AND_WHEN("A risk creeps up in steps below the threshold")
+      {
+        for (int step_i = 1; step_i <= 4; step_i++)
+        {
+          changed_is.clear();
+          const std::vector<float> creeping_risks = {0.5f + 0.02f * step_i,
+                                                     fsweep::RiskLayer::NO_RISK, 0.0f, 1.0f};
+          risk_layer.Update(creeping_risks, changed_is);
+        }
+
+        THEN("The level follows once the risk moved past the threshold in total")
+        {
+          CHECK(risk_layer.GetLevel(0) == fsweep::RiskLayer::GetRiskLevel(0.58f));
+        }
+      }
+    }
+  }
+}
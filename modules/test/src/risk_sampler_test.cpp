@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <cstddef>
+#include <fsweep/RiskSampler.hpp>
+#include <fsweep/ThreadPool.hpp>
+#include <vector>
+
+SCENARIO("A RiskSampler estimates the risks of constrained Buttons", "[RiskSampler]")
+{
+  fsweep::ThreadPool thread_pool(2);
+  fsweep::RiskSampler risk_sampler(thread_pool);
+
+  GIVEN("Two overlapping constraints with three Buttons in the interior and two bombs left")
+  {
+    // a + b + c = 1 and c + d = 1: c alone leaves one bomb for the interior, which it can hide in
+    // three ways, while d and one of a or b leave none, so c has a risk of 3 / 5
+    risk_sampler.AddConstraint(std::vector<std::size_t>{10, 11, 12}, 1);
+    risk_sampler.AddConstraint(std::vector<std::size_t>{12, 13}, 1);
+    risk_sampler.SetTimeBudget(std::chrono::milliseconds(200));
+
+    WHEN("The RiskSampler samples")
+    {
+      risk_sampler.Sample(3, 2, 1);
+
+      THEN("The risks are close to the exact risks")
+      {
+        REQUIRE(risk_sampler.GetSampleCount() > 0);
+        REQUIRE(risk_sampler.GetButtons().size() == 4);
+        CHECK(risk_sampler.GetButtons()[0] == 10);
+        CHECK(risk_sampler.GetButtons()[3] == 13);
+        const auto risks = risk_sampler.GetRisks();
+        CHECK(risks[0] == Catch::Approx(0.2).margin(0.03));
+        CHECK(risks[1] == Catch::Approx(0.2).margin(0.03));
+        CHECK(risks[2] == Catch::Approx(0.6).margin(0.03));
+        CHECK(risks[3] == Catch::Approx(0.4).margin(0.03));
+        CHECK(risk_sampler.GetInteriorRisk() == Catch::Approx(0.2).margin(0.03));
+      }
+
+      THEN("The margins are small but not zero")
+      {
+        for (const auto margin : risk_sampler.GetMargins())
+        {
+          CHECK(margin > 0.0f);
+          CHECK(margin < 0.03f);
+        }
+      }
+    }
+
+    WHEN("The RiskSampler is cleared")
+    {
+      risk_sampler.Sample(3, 2, 1);
+      risk_sampler.Clear();
+
+      THEN("It has no results")
+      {
+        CHECK(risk_sampler.GetButtons().empty());
+        CHECK(risk_sampler.GetRisks().empty());
+        CHECK(risk_sampler.GetSampleCount() == 0);
+      }
+    }
+  }
+
+  GIVEN("Thousands of Buttons in pairs that each hide one bomb")
+  {
+    const std::size_t pair_count = 1000;
+    for (std::size_t pair_i = 0; pair_i < pair_count; pair_i++)
+    {
+      risk_sampler.AddConstraint(std::vector<std::size_t>{pair_i * 2, pair_i * 2 + 1}, 1);
+    }
+    risk_sampler.SetTimeBudget(std::chrono::milliseconds(200));
+
+    WHEN("The RiskSampler samples")
+    {
+      const auto start = std::chrono::steady_clock::now();
+      risk_sampler.Sample(1000, pair_count + 100, 2);
+      const auto elapsed = std::chrono::steady_clock::now() - start;
+
+      THEN("It stops near the time budget with a risk of about one half for every Button")
+      {
+        CHECK(elapsed < std::chrono::milliseconds(2000));
+        REQUIRE(risk_sampler.GetSampleCount() > 0);
+        REQUIRE(risk_sampler.GetRisks().size() == pair_count * 2);
+        for (const auto risk : risk_sampler.GetRisks())
+        {
+          CHECK(risk > 0.1f);
+          CHECK(risk < 0.9f);
+        }
+        CHECK(risk_sampler.GetInteriorRisk() == Catch::Approx(0.1));
+      }
+    }
+  }
+
+  GIVEN("A constraint that cannot be met with the bombs left")
+  {
+    risk_sampler.AddConstraint(std::vector<std::size_t>{0, 1}, 1);
+    risk_sampler.SetTimeBudget(std::chrono::milliseconds(10));
+
+    WHEN("The RiskSampler samples")
+    {
+      risk_sampler.Sample(5, 8, 3);
+
+      THEN("It has no samples")
+      {
+        CHECK(risk_sampler.GetSampleCount() == 0);
+        CHECK(risk_sampler.GetRisks().size() == 2);
+      }
+    }
+  }
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <fsweep/ThreadPool.hpp>
+#include <vector>
+
+SCENARIO("Tasks are run by a ThreadPool")
+{
+  GIVEN("A ThreadPool with 4 threads")
+  {
+    fsweep::ThreadPool thread_pool(4);
+
+    THEN("The ThreadPool has 4 threads") { CHECK(thread_pool.GetThreadCount() == 4); }
+
+    WHEN("1000 tasks are run 10 times")
+    {
+      std::vector<std::atomic<int>> task_runs(1000);
+      for (int repeat_i = 0; repeat_i < 10; repeat_i++)
+      {
+        thread_pool.ParallelFor(task_runs.size(),
+                                [&](std::size_t task_i) { task_runs[task_i].fetch_add(1); });
+      }
+
+      THEN("Every task is run 10 times")
+      {
+        for (const auto& task_run : task_runs)
+        {
+          REQUIRE(task_run.load() == 10);
+        }
+      }
+    }
+  }
+
+  GIVEN("A ThreadPool with 1 thread")
+  {
+    fsweep::ThreadPool thread_pool(1);
+
+    WHEN("3 tasks are run")
+    {
+      std::vector<std::size_t> task_order;
+      thread_pool.ParallelFor(3, [&](std::size_t task_i) { task_order.push_back(task_i); });
+
+      THEN("The tasks are run in order on the calling thread")
+      {
+        CHECK(task_order == std::vector<std::size_t>{0, 1, 2});
+      }
+    }
+  }
+}
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2022 Daniel Valcour <fosssweeper@gmail.com>
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+/*
+ * Copyright (c) 2022 Daniel Valcour
+ *
+ * This file is part of FossSweeper.
+ *
+ * FossSweeper is free software: you can redistribute it and/or modify it under the terms of the GNU
+ * General Public License as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * FossSweeper is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+ * even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with FossSweeper. If not,
+ * see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <catch2/catch_all.hpp>
+#include <fsweep/Trace.hpp>
+#include <sstream>
+#include <string>
+
+SCENARIO("Trace events are recorded")
+{
+  GIVEN("A TraceRecorder with no events")
+  {
+    fsweep::TraceRecorder trace_recorder;
+
+    WHEN("A zone and a counter are recorded")
+    {
+      trace_recorder.RecordZone("zone", 10.0, 25.0);
+      trace_recorder.RecordCounter("counter", 42);
+
+      THEN("Both events are stored in order")
+      {
+        const auto events = trace_recorder.GetEvents();
+        REQUIRE(events.size() == 2);
+        CHECK(events[0].type == fsweep::TraceEventType::Zone);
+        CHECK(std::string(events[0].name) == "zone");
+        CHECK(events[0].start_us == 10.0);
+        CHECK(events[0].duration_us == 15.0);
+        CHECK(events[1].type == fsweep::TraceEventType::Counter);
+        CHECK(std::string(events[1].name) == "counter");
+        CHECK(events[1].value == 42);
+      }
+
+      THEN("The Chrome trace contains a complete event and a counter event")
+      {
+        std::stringstream stream;
+        trace_recorder.WriteChromeTrace(stream);
+        const auto trace = stream.str();
+        CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+        CHECK(trace.find("\"name\":\"zone\"") != std::string::npos);
+        CHECK(trace.find("\"ph\":\"X\",\"dur\":15") != std::string::npos);
+        CHECK(trace.find("\"ph\":\"C\",\"args\":{\"value\":42}") != std::string::npos);
+      }
+
+      WHEN("The TraceRecorder is cleared")
+      {
+        trace_recorder.Clear();
+
+        THEN("There are no events") { CHECK(trace_recorder.GetEvents().empty()); }
+      }
+    }
+
+    WHEN("A zone is recorded long after the trace started")
+    {
+      trace_recorder.RecordZone("late", 123456789.25, 123456789.75);
+
+      THEN("The Chrome trace keeps its timestamps to the nanosecond")
+      {
+        std::stringstream stream;
+        trace_recorder.WriteChromeTrace(stream);
+        const auto trace = stream.str();
+        CHECK(trace.find("\"ts\":123456789.250") != std::string::npos);
+        CHECK(trace.find("\"dur\":0.500") != std::string::npos);
+      }
+    }
+  }
+}
+
+SCENARIO("A TraceZone records its duration into the global TraceRecorder")
+{
+  GIVEN("A cleared global TraceRecorder")
+  {
+    auto& trace_recorder = fsweep::TraceRecorder::GetInstance();
+    trace_recorder.Clear();
+
+    WHEN("A TraceZone goes out of scope")
+    {
+      {
+        const fsweep::TraceZone trace_zone("scoped");
+      }
+
+      THEN("One zone event is recorded")
+      {
+        const auto events = trace_recorder.GetEvents();
+        REQUIRE(events.size() == 1);
+        CHECK(std::string(events[0].name) == "scoped");
+        CHECK(events[0].duration_us >= 0.0);
+      }
+    }
+  }
+}